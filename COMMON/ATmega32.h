@@ -15,18 +15,7 @@
 /* ----------------------------------------------------------------------------------- */
 /* ------------------Includes section------------------- */
 #include "std_types.h"
-
-
-/* ----------------------------------------------------------------------------------- */
-/* --MCU Frequency & Clock Period Calculation section--- */
-
-
-/* Calculations to get the period of one Clock Pulse */
-
-/* MCU Frequency (F_CPU) */
-#define CPU_FREQUENCY			8000000.0
-/* Period of one Clock Pulse in us from Frequency of timer and the pre-scaler */
-#define PERIOD_US(prescaler)	( (1000000.0) / ( (CPU_FREQUENCY) / (prescaler) ) )
+#include "timing.h"				/* MCU Frequency (CPU_FREQUENCY) and the integer timing calculations */
 
 
 /* ----------------------------------------------------------------------------------- */
@@ -48,6 +37,17 @@
 
 #define SFIOR_ADDRESS			0x50	/* Special Function IO Register */
 
+/*
+ * ---------------------------------
+ * External Interrupt Registers
+ * ---------------------------------
+ */
+
+#define MCUCR_ADDRESS			0x55	/* MCU Control Register */
+#define MCUCSR_ADDRESS			0x54	/* MCU Control and Status Register */
+#define GICR_ADDRESS			0x5B	/* General Interrupt Control Register */
+#define GIFR_ADDRESS			0x5A	/* General Interrupt Flag Register */
+
 /*
  * ---------------------------------
  * TIMERx Control Registers
@@ -241,15 +241,95 @@ typedef union
 
 	struct
 	{
-		uint8 _PSR10:1;			/* Bit 0 – PSR10: Prescaler Reset Timer/Counter1 and Timer/Counter0 */
-		uint8 _PSR2 :1;			/* Bit 1 – PSR2: Prescaler Reset Timer/Counter2 */
-		uint8 _PUD  :1;			/* Bit 2 – PUD: Pull-up disable */
-		uint8 _ACME :1;			/* Bit 3 – ACME: Analog Comparator Multiplexer Enable */
+		uint8       :1;			/* Bit 0 – PSR10: Prescaler Reset Timer/Counter1 and Timer/Counter0 */
+		uint8       :1;			/* Bit 1 – PSR2: Prescaler Reset Timer/Counter2 */
+		uint8       :1;			/* Bit 2 – PUD: Pull-up disable */
+		uint8       :1;			/* Bit 3 – ACME: Analog Comparator Multiplexer Enable */
 		uint8	   	:1;			/* Reserved */
 		uint8 _ADTSx:3;			/* Bit 7:5 – ADTS2:0: ADC Auto Trigger Source */
 	};
 }SFIOR_CFG_t;
 
+/*
+ * ---------------------------------
+ * External Interrupt Registers
+ * ---------------------------------
+ */
+
+/* MCU Control Register */
+typedef union
+{
+	uint8 Byte;
+
+	struct
+	{
+		uint8 _ISC00:1;			/* Bit 0 – ISC00: Interrupt Sense Control 0 Bit 0 */
+		uint8 _ISC01:1;			/* Bit 1 – ISC01: Interrupt Sense Control 0 Bit 1 */
+		uint8 _ISC10:1;			/* Bit 2 – ISC10: Interrupt Sense Control 1 Bit 0 */
+		uint8 _ISC11:1;			/* Bit 3 – ISC11: Interrupt Sense Control 1 Bit 1 */
+		uint8 _SM0  :1;			/* Bit 4 – SM0: Sleep Mode Select Bit 0 */
+		uint8 _SM1  :1;			/* Bit 5 – SM1: Sleep Mode Select Bit 1 */
+		uint8 _SM2  :1;			/* Bit 6 – SM2: Sleep Mode Select Bit 2 */
+		uint8 _SE   :1;			/* Bit 7 – SE: Sleep Enable */
+	};
+
+	struct
+	{
+		uint8 _ISC0x:2;			/* Bit 1:0 – ISC01:0: Interrupt Sense Control 0 */
+		uint8 _ISC1x:2;			/* Bit 3:2 – ISC11:0: Interrupt Sense Control 1 */
+		uint8 _SMx  :3;			/* Bit 6:4 – SM2:0: Sleep Mode Select */
+		uint8 		:1;			/* Bit 7 – SE: Sleep Enable */
+	};
+}MCUCR_CFG_t;
+
+/* MCU Control and Status Register */
+typedef union
+{
+	uint8 Byte;
+
+	struct
+	{
+		uint8 _PORF :1;			/* Bit 0 – PORF: Power-on Reset Flag */
+		uint8 _EXTRF:1;			/* Bit 1 – EXTRF: External Reset Flag */
+		uint8 _BORF :1;			/* Bit 2 – BORF: Brown-out Reset Flag */
+		uint8 _WDRF :1;			/* Bit 3 – WDRF: Watchdog Reset Flag */
+		uint8 _JTRF :1;			/* Bit 4 – JTRF: JTAG Reset Flag */
+		uint8	   	:1;			/* Reserved */
+		uint8 _ISC2 :1;			/* Bit 6 – ISC2: Interrupt Sense Control 2 */
+		uint8 _JTD  :1;			/* Bit 7 – JTD: JTAG Interface Disable */
+	};
+}MCUCSR_CFG_t;
+
+/* General Interrupt Control Register */
+typedef union
+{
+	uint8 Byte;
+
+	struct
+	{
+		uint8 _IVCE :1;			/* Bit 0 – IVCE: Interrupt Vector Change Enable */
+		uint8 _IVSEL:1;			/* Bit 1 – IVSEL: Interrupt Vector Select */
+		uint8	   	:3;			/* Reserved */
+		uint8 _INT2 :1;			/* Bit 5 – INT2: External Interrupt Request 2 Enable */
+		uint8 _INT0 :1;			/* Bit 6 – INT0: External Interrupt Request 0 Enable */
+		uint8 _INT1 :1;			/* Bit 7 – INT1: External Interrupt Request 1 Enable */
+	};
+}GICR_CFG_t;
+
+/* General Interrupt Flag Register */
+typedef union
+{
+	uint8 Byte;
+
+	struct
+	{
+		uint8	   	:5;			/* Reserved */
+		uint8 _INTF2:1;			/* Bit 5 – INTF2: External Interrupt Flag 2 */
+		uint8 _INTF0:1;			/* Bit 6 – INTF0: External Interrupt Flag 0 */
+		uint8 _INTF1:1;			/* Bit 7 – INTF1: External Interrupt Flag 1 */
+	};
+}GIFR_CFG_t;
+
 /*
  * ---------------------------------
  * TIMERx Control Registers
@@ -336,10 +416,10 @@ typedef union
 	struct
 	{
 		uint8 _CS0x :3;			/* Bit 2:0 – CS02:0: Clock Select */
-		uint8 _WGM01:1;			/* Bit 3 – WGM01: Waveform Generation Mode */
+		uint8       :1;			/* Bit 3 – WGM01: Waveform Generation Mode */
 		uint8 _COM0x:2;			/* Bit 5:4 – COM01:0: Compare Match Output Mode */
 		uint8 _WGM00:1;			/* Bit 6 – WGM00: Waveform Generation Mode */
-		uint8 _FOC0 :1;			/* Bit 7 – FOC0: Force Output Compare */
+		uint8       :1;			/* Bit 7 – FOC0: Force Output Compare */
 		};
 }TCCR0_CFG_t;
 
@@ -387,8 +467,8 @@ typedef union
 	struct
 	{
 		uint8 _WGM1x :2;		/* Bit 1:0 – WGM11:0: Waveform Generation Mode */
-		uint8 _FOC1B :1;		/* Bit 2 – FOC1B: Force Output Compare for Compare unit B */
-		uint8 _FOC1A :1;		/* Bit 3 – FOC1A: Force Output Compare for Compare unit A */
+		uint8        :1;		/* Bit 2 – FOC1B: Force Output Compare for Compare unit B */
+		uint8        :1;		/* Bit 3 – FOC1A: Force Output Compare for Compare unit A */
 		uint8 _COM1Bx:2;		/* Bit 5:4 – COM1B1:0: Compare Output Mode for Compare unit B */
 		uint8 _COM1Ax:2;		/* Bit 7:6 – COM1A1:0: Compare Output Mode for Compare unit A */
 	};
@@ -416,8 +496,8 @@ typedef union
 		uint8 _CS1x :3;			/* Bit 2:0 – CS12:0: Clock Select */
 		uint8 _WGM1x:2;			/* Bit 4:3 – WGM13:2: Waveform Generation Mode */
 		uint8 	   	:1;			/* Reserved */
-		uint8 _ICES1:1;			/* Bit 6 – ICES1: Input Capture Edge Select */
-		uint8 _ICNC1:1;			/* Bit 7 – ICNC1: Input Capture Noise Canceler */
+		uint8       :1;			/* Bit 6 – ICES1: Input Capture Edge Select */
+		uint8       :1;			/* Bit 7 – ICNC1: Input Capture Noise Canceler */
 	};
 }TCCR1B_CFG_t;
 
@@ -845,12 +925,12 @@ typedef union
 	struct
 	{
 		uint8 _SPRx:2;			/* Bits 1, 0 – SPR1, SPR0: SPI Clock Rate Select 1 and 0 */
-		uint8 _CPHA:1;			/* Bit 2 – CPHA: Clock Phase */
-		uint8 _CPOL:1;			/* Bit 3 – CPOL: Clock Polarity */
-		uint8 _MSTR:1;			/* Bit 4 – MSTR: Master/Slave Select */
-		uint8 _DORD:1;			/* Bit 5 – DORD: Data Order */
-		uint8 _SPE :1;			/* Bit 6 – SPE: SPI Enable */
-		uint8 _SPIE:1;			/* Bit 7 – SPIE: SPI Interrupt Enable */
+		uint8      :1;			/* Bit 2 – CPHA: Clock Phase */
+		uint8      :1;			/* Bit 3 – CPOL: Clock Polarity */
+		uint8      :1;			/* Bit 4 – MSTR: Master/Slave Select */
+		uint8      :1;			/* Bit 5 – DORD: Data Order */
+		uint8      :1;			/* Bit 6 – SPE: SPI Enable */
+		uint8      :1;			/* Bit 7 – SPIE: SPI Interrupt Enable */
 	};
 }SPCR_CFG_t;
 
@@ -933,12 +1013,12 @@ typedef union
 
 	struct
 	{
-		uint8 _UCPOL:1;			/* Bit 0 – UCPOL: Clock Polarity */
+		uint8       :1;			/* Bit 0 – UCPOL: Clock Polarity */
 		uint8 _UCSZx:2;			/* Bit 2:1 – UCSZ1:0: Character Size */
-		uint8 _USBS :1;			/* Bit 3 – USBS: Stop Bit Select */
+		uint8       :1;			/* Bit 3 – USBS: Stop Bit Select */
 		uint8 _UPMx :2;			/* Bit 5:4 – UPM1:0: Parity Mode */
-		uint8 _UMSEL:1;			/* Bit 6 – UMSEL: USART Mode Select */
-		uint8 _URSEL:1;			/* Bit 7 – URSEL: Register Select */
+		uint8       :1;			/* Bit 6 – UMSEL: USART Mode Select */
+		uint8       :1;			/* Bit 7 – URSEL: Register Select */
 	};
 }UCSRC_CFG_t;
 
@@ -981,7 +1061,7 @@ typedef union
 	{
 		uint8 UBRRHx:4;			/* The UBRRH contains the four most significant bits of USART baud rate */
 		uint8		:3;			/* Reserved */
-		uint8 _URSEL:1;			/* Bit 15 – URSEL: Register Select */
+		uint8       :1;			/* Bit 15 – URSEL: Register Select */
 	};
 }UBRRH_CFG_t;
 
@@ -1011,7 +1091,7 @@ typedef union
 	struct
 	{
 		uint8 _MUXx :5;			/* Bits 4:0 – MUX4:0: Analog Channel and Gain Selection Bits */
-		uint8 _ADLAR:1;			/* Bit 5 – ADLAR: ADC Left Adjust Result */
+		uint8       :1;			/* Bit 5 – ADLAR: ADC Left Adjust Result */
 		uint8 _REFSx:2;			/* Bit 7:6 – REFS1:0: Reference Selection Bits */
 	};
 }ADMUX_CFG_t;
@@ -1036,11 +1116,11 @@ typedef union
 	struct
 	{
 		uint8 _ADPSx:3;			/* Bits 2:0 – ADPS2:0: ADC Prescaler Select Bits */
-		uint8 _ADIE :1;			/* Bit 3 – ADIE: ADC Interrupt Enable */
-		uint8 _ADIF :1;			/* Bit 4 – ADIF: ADC Interrupt Flag */
-		uint8 _ADATE:1;			/* Bit 5 – ADATE: ADC Auto Trigger Enable */
-		uint8 _ADSC :1;			/* Bit 6 – ADSC: ADC Start Conversion */
-		uint8 _ADEN :1;			/* Bit 7 – ADEN: ADC Enable */
+		uint8       :1;			/* Bit 3 – ADIE: ADC Interrupt Enable */
+		uint8       :1;			/* Bit 4 – ADIF: ADC Interrupt Flag */
+		uint8       :1;			/* Bit 5 – ADATE: ADC Auto Trigger Enable */
+		uint8       :1;			/* Bit 6 – ADSC: ADC Start Conversion */
+		uint8       :1;			/* Bit 7 – ADEN: ADC Enable */
 	};
 }ADCSRA_CFG_t;
 
@@ -1117,7 +1197,7 @@ typedef union
 
 	struct
 	{
-		uint8 _TWGCE:1;			/* Bit 0 – TWGCE: TWI General Call Recognition Enable Bit */
+		uint8       :1;			/* Bit 0 – TWGCE: TWI General Call Recognition Enable Bit */
 		uint8 _TWAx :7;			/* Bits 7..1 – TWA: TWI (Slave) Address Register */
 	};
 }TWAR_CFG_t;
@@ -1166,6 +1246,35 @@ typedef union
 }TWBR_CFG_t;
 
 
+/* ----------------------------------------------------------------------------------- */
+/* -----------------Host Build section------------------ */
+
+/*
+ * Host Build :
+ * 	- ATMEGA32_HOST_BUILD = ENABLE (compile with -DATMEGA32_HOST_BUILD=1) maps every Register to a RAM register file
+ * 	  so MCAL/HAL/SERVICE are compiled unchanged and run on a PC >> @ref : COMMON/HOST/host_registers.h
+ * 	- otherwise (target build) every Register is accessed at its fixed data memory address
+ */
+
+#ifndef ATMEGA32_HOST_BUILD
+#define ATMEGA32_HOST_BUILD		DISABLE
+#endif
+
+#if ATMEGA32_HOST_BUILD
+
+#include "host_registers.h"
+
+/* the Register is taken from the host register file (the access/write hooks of the Register are called) */
+#define REG_ACCESS(TYPE,ADDRESS)	( *(volatile TYPE *)HOST_REG_access( (ADDRESS) , sizeof(TYPE) ) )
+
+#else
+
+/* the Register is taken from its fixed data memory address */
+#define REG_ACCESS(TYPE,ADDRESS)	( *(volatile TYPE * const)(ADDRESS) )
+
+#endif
+
+
 /* ----------------------------------------------------------------------------------- */
 /* ----------------Registers Definition----------------- */
 
@@ -1176,12 +1285,16 @@ typedef union
  */
 
 /* Status Register */
-#define _SREG					( *(volatile SREG_CFG_t * const)(SREG_ADDRESS) )
+#define _SREG					REG_ACCESS( SREG_CFG_t , SREG_ADDRESS )
 
 /* -- Global Interrupt Enable/Disable -- */
 #define GLOBAL_INTERRUPT_ENABLE()			(_SREG._I = SET)
 #define GLOBAL_INTERRUPT_DISABLE()			(_SREG._I = RESET)
 
+/* -- Critical Section (save the Status Register then disable the Global Interrupt, restore the saved Status Register on exit) -- */
+#define CRITICAL_SECTION_ENTER(SREG_COPY)	do{ (SREG_COPY) = _SREG.Byte; GLOBAL_INTERRUPT_DISABLE(); }while(0)
+#define CRITICAL_SECTION_EXIT(SREG_COPY)	(_SREG.Byte = (SREG_COPY))
+
 /*
  * ---------------------------------
  * SFIOR : Special Function IO Register
@@ -1189,7 +1302,25 @@ typedef union
  */
 
 /* Special Function IO Register */
-#define _SFIOR					( *(volatile SFIOR_CFG_t * const)(SFIOR_ADDRESS) )
+#define _SFIOR					REG_ACCESS( SFIOR_CFG_t , SFIOR_ADDRESS )
+
+/*
+ * ---------------------------------
+ * External Interrupt Registers
+ * ---------------------------------
+ */
+
+/* MCU Control Register */
+#define _MCUCR					REG_ACCESS( MCUCR_CFG_t , MCUCR_ADDRESS )
+
+/* MCU Control and Status Register */
+#define _MCUCSR					REG_ACCESS( MCUCSR_CFG_t , MCUCSR_ADDRESS )
+
+/* General Interrupt Control Register */
+#define _GICR					REG_ACCESS( GICR_CFG_t , GICR_ADDRESS )
+
+/* General Interrupt Flag Register */
+#define _GIFR					REG_ACCESS( GIFR_CFG_t , GIFR_ADDRESS )
 
 /*
  * ---------------------------------
@@ -1198,10 +1329,10 @@ typedef union
  */
 
 /* Timer/Counter Interrupt Mask Register */
-#define _TIMSK					( *(volatile TIMSK_CFG_t * const)(TIMSK_ADDRESS) )
+#define _TIMSK					REG_ACCESS( TIMSK_CFG_t , TIMSK_ADDRESS )
 
 /* Timer/Counter Interrupt Flag Register */
-#define _TIFR					( *(volatile TIFR_CFG_t * const)(TIFR_ADDRESS) )
+#define _TIFR					REG_ACCESS( TIFR_CFG_t , TIFR_ADDRESS )
 
 /*
  * ---------------------------------
@@ -1210,13 +1341,13 @@ typedef union
  */
 
 /* Output Compare Register */
-#define _OCR0					( *(volatile OCR0_CFG_t * const)(OCR0_ADDRESS) )
+#define _OCR0					REG_ACCESS( OCR0_CFG_t , OCR0_ADDRESS )
 
 /* Timer/Counter Control Register */
-#define _TCCR0					( *(volatile TCCR0_CFG_t * const)(TCCR0_ADDRESS) )
+#define _TCCR0					REG_ACCESS( TCCR0_CFG_t , TCCR0_ADDRESS )
 
 /* Timer/Counter Register */
-#define _TCNT0					( *(volatile TCNT0_CFG_t * const)(TCNT0_ADDRESS) )
+#define _TCNT0					REG_ACCESS( TCNT0_CFG_t , TCNT0_ADDRESS )
 
 /*
  * ---------------------------------
@@ -1225,22 +1356,22 @@ typedef union
  */
 
 /* Timer/Counter1 Control Register A */
-#define _TCCR1A					( *(volatile TCCR1A_CFG_t * const)(TCCR1A_ADDRESS) )
+#define _TCCR1A					REG_ACCESS( TCCR1A_CFG_t , TCCR1A_ADDRESS )
 
 /* Timer/Counter1 Control Register B */
-#define _TCCR1B					( *(volatile TCCR1B_CFG_t * const)(TCCR1B_ADDRESS) )
+#define _TCCR1B					REG_ACCESS( TCCR1B_CFG_t , TCCR1B_ADDRESS )
 
 /* Timer/Counter Register */
-#define _TCNT1					( *(volatile TCNT1_CFG_t * const)(TCNT1L_ADDRESS) )
+#define _TCNT1					REG_ACCESS( TCNT1_CFG_t , TCNT1L_ADDRESS )
 
 /* Output Compare Register 1 A */
-#define _OCR1A					( *(volatile OCR1A_CFG_t * const)(OCR1AL_ADDRESS) )
+#define _OCR1A					REG_ACCESS( OCR1A_CFG_t , OCR1AL_ADDRESS )
 
 /* Output Compare Register 1 B */
-#define _OCR1B					( *(volatile OCR1B_CFG_t * const)(OCR1BL_ADDRESS) )
+#define _OCR1B					REG_ACCESS( OCR1B_CFG_t , OCR1BL_ADDRESS )
 
 /* Input Capture Register 1 */
-#define _ICR1					( *(volatile ICR1_CFG_t * const)(ICR1L_ADDRESS) )
+#define _ICR1					REG_ACCESS( ICR1_CFG_t , ICR1L_ADDRESS )
 
 /*
  * ---------------------------------
@@ -1248,9 +1379,9 @@ typedef union
  * ---------------------------------
  */
 
-#define _TCCR2					( *(volatile TCCR2_CFG_t * const)(TCCR2_ADDRESS) )
-#define _TCNT2					( *(volatile TCNT2_CFG_t * const)(TCNT2_ADDRESS) )
-#define _OCR2					( *(volatile OCR2_CFG_t * const)(OCR2_ADDRESS) )
+#define _TCCR2					REG_ACCESS( TCCR2_CFG_t , TCCR2_ADDRESS )
+#define _TCNT2					REG_ACCESS( TCNT2_CFG_t , TCNT2_ADDRESS )
+#define _OCR2					REG_ACCESS( OCR2_CFG_t , OCR2_ADDRESS )
 
 /*
  * ---------------------------------
@@ -1258,7 +1389,7 @@ typedef union
  * ---------------------------------
  */
 
-#define _WDTCR					( *(volatile WDTCR_CFG_t * const)(WDTCR_ADDRESS) )
+#define _WDTCR					REG_ACCESS( WDTCR_CFG_t , WDTCR_ADDRESS )
 
 /*
  * ---------------------------------
@@ -1267,13 +1398,13 @@ typedef union
  */
 
 /* Port A Data Register */
-#define _PORTA					( *(volatile PORTA_CFG_t * const)(PORTA_ADDRESS) )
+#define _PORTA					REG_ACCESS( PORTA_CFG_t , PORTA_ADDRESS )
 
 /* Port A Data Direction Register */
-#define _DDRA					( *(volatile DDRA_CFG_t * const)(DDRA_ADDRESS) )
+#define _DDRA					REG_ACCESS( DDRA_CFG_t , DDRA_ADDRESS )
 
 /* Port A Input Pins Address */
-#define _PINA					( *(volatile const PINA_CFG_t * const)(PINA_ADDRESS) )
+#define _PINA					REG_ACCESS( const PINA_CFG_t , PINA_ADDRESS )
 
 /*
  * ---------------------------------
@@ -1282,13 +1413,13 @@ typedef union
  */
 
 /* Port B Data Register */
-#define _PORTB					( *(volatile PORTB_CFG_t * const)(PORTB_ADDRESS) )
+#define _PORTB					REG_ACCESS( PORTB_CFG_t , PORTB_ADDRESS )
 
 /* Port B Data Direction Register */
-#define _DDRB					( *(volatile DDRB_CFG_t * const)(DDRB_ADDRESS) )
+#define _DDRB					REG_ACCESS( DDRB_CFG_t , DDRB_ADDRESS )
 
 /* Port B Input Pins Address */
-#define _PINB					( *(volatile const PINB_CFG_t * const)(PINB_ADDRESS) )
+#define _PINB					REG_ACCESS( const PINB_CFG_t , PINB_ADDRESS )
 
 /*
  * ---------------------------------
@@ -1297,13 +1428,13 @@ typedef union
  */
 
 /* Port C Data Register */
-#define _PORTC					( *(volatile PORTC_CFG_t * const)(PORTC_ADDRESS) )
+#define _PORTC					REG_ACCESS( PORTC_CFG_t , PORTC_ADDRESS )
 
 /* Port C Data Direction Register */
-#define _DDRC					( *(volatile DDRC_CFG_t * const)(DDRC_ADDRESS) )
+#define _DDRC					REG_ACCESS( DDRC_CFG_t , DDRC_ADDRESS )
 
 /* Port C Input Pins Address */
-#define _PINC					( *(volatile const PINC_CFG_t * const)(PINC_ADDRESS) )
+#define _PINC					REG_ACCESS( const PINC_CFG_t , PINC_ADDRESS )
 
 
 /*
@@ -1313,13 +1444,13 @@ typedef union
  */
 
 /* Port D Data Register */
-#define _PORTD					( *(volatile PORTD_CFG_t * const)(PORTD_ADDRESS) )
+#define _PORTD					REG_ACCESS( PORTD_CFG_t , PORTD_ADDRESS )
 
 /* Port D Data Direction Register */
-#define _DDRD					( *(volatile DDRD_CFG_t * const)(DDRD_ADDRESS) )
+#define _DDRD					REG_ACCESS( DDRD_CFG_t , DDRD_ADDRESS )
 
 /* Port D Input Pins Address */
-#define _PIND					( *(volatile const PIND_CFG_t * const)(PIND_ADDRESS) )
+#define _PIND					REG_ACCESS( const PIND_CFG_t , PIND_ADDRESS )
 
 /*
  * ---------------------------------
@@ -1328,13 +1459,13 @@ typedef union
  */
 
 /* SPI Data Register */
-#define _SPDR					( *(volatile SPDR_CFG_t * const)(SPDR_ADDRESS) )
+#define _SPDR					REG_ACCESS( SPDR_CFG_t , SPDR_ADDRESS )
 
 /* SPI Status Register */
-#define _SPSR					( *(volatile SPSR_CFG_t * const)(SPSR_ADDRESS) )
+#define _SPSR					REG_ACCESS( SPSR_CFG_t , SPSR_ADDRESS )
 
 /* SPI Control Register */
-#define _SPCR					( *(volatile SPCR_CFG_t * const)(SPCR_ADDRESS) )
+#define _SPCR					REG_ACCESS( SPCR_CFG_t , SPCR_ADDRESS )
 
 /*
  * ---------------------------------
@@ -1343,22 +1474,22 @@ typedef union
  */
 
 /* USART I/O Data Register */
-#define _UDR					( *(volatile UDR_CFG_t * const)(UDR_ADDRESS) )
+#define _UDR					REG_ACCESS( UDR_CFG_t , UDR_ADDRESS )
 
 /* USART Control and Status Register A */
-#define _UCSRA					( *(volatile UCSRA_CFG_t * const)(UCSRA_ADDRESS) )
+#define _UCSRA					REG_ACCESS( UCSRA_CFG_t , UCSRA_ADDRESS )
 
 /* USART Control and Status Register B */
-#define _UCSRB					( *(volatile UCSRB_CFG_t * const)(UCSRB_ADDRESS) )
+#define _UCSRB					REG_ACCESS( UCSRB_CFG_t , UCSRB_ADDRESS )
 
 /* USART Control and Status Register C */
-#define _UCSRC					( *(volatile UCSRC_CFG_t * const)(UCSRC_ADDRESS) )
+#define _UCSRC					REG_ACCESS( UCSRC_CFG_t , UCSRC_ADDRESS )
 
 /* USART Baud Rate Register Low Byte */
-#define _UBRRL					( *(volatile UBRRL_CFG_t * const)(UBRRL_ADDRESS) )
+#define _UBRRL					REG_ACCESS( UBRRL_CFG_t , UBRRL_ADDRESS )
 
 /* USART Baud Rate Register High Byte */
-#define _UBRRH					( *(volatile UBRRH_CFG_t * const)(UBRRH_ADDRESS) )
+#define _UBRRH					REG_ACCESS( UBRRH_CFG_t , UBRRH_ADDRESS )
 
 /*
  * ---------------------------------
@@ -1367,13 +1498,13 @@ typedef union
  */
 
 /* ADC Multiplexer Selection Register */
-#define _ADMUX					( *(volatile ADMUX_CFG_t * const)(ADMUX_ADDRESS) )
+#define _ADMUX					REG_ACCESS( ADMUX_CFG_t , ADMUX_ADDRESS )
 
 /* ADC Control and Status Register A */
-#define _ADCSRA					( *(volatile ADCSRA_CFG_t * const)(ADCSRA_ADDRESS) )
+#define _ADCSRA					REG_ACCESS( ADCSRA_CFG_t , ADCSRA_ADDRESS )
 
 /* The ADC Data Register */
-#define _ADC					( *(volatile ADC_CFG_t * const)(ADCL_ADDRESS) )
+#define _ADC					REG_ACCESS( ADC_CFG_t , ADCL_ADDRESS )
 
 /*
  * ---------------------------------
@@ -1382,19 +1513,26 @@ typedef union
  */
 
 /* TWI Control Register */
-#define _TWCR					( *(volatile TWCR_CFG_t * const)(TWCR_ADDRESS) )
+#define _TWCR					REG_ACCESS( TWCR_CFG_t , TWCR_ADDRESS )
 
 /* TWI Data Register */
-#define _TWDR					( *(volatile TWDR_CFG_t * const)(TWDR_ADDRESS) )
+#define _TWDR					REG_ACCESS( TWDR_CFG_t , TWDR_ADDRESS )
 
 /* TWI (Slave) Address Register */
-#define _TWAR					( *(volatile TWAR_CFG_t * const)(TWAR_ADDRESS) )
+#define _TWAR					REG_ACCESS( TWAR_CFG_t , TWAR_ADDRESS )
 
 /* TWI Status Register */
-#define _TWSR					( *(volatile TWSR_CFG_t * const)(TWSR_ADDRESS) )
+#define _TWSR					REG_ACCESS( TWSR_CFG_t , TWSR_ADDRESS )
 
 /* TWI Bit Rate Register */
-#define _TWBR					( *(volatile TWBR_CFG_t * const)(TWBR_ADDRESS) )
+#define _TWBR					REG_ACCESS( TWBR_CFG_t , TWBR_ADDRESS )
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Register Access section---------------- */
+
+/* access any 8-bit Register through its data memory address (used by the table driven drivers) */
+#define IO_REG8(ADDRESS)		REG_ACCESS( uint8 , (uint16)(ADDRESS) )
 
 
 /* ----------------------------------------------------------------------------------- */
@@ -0,0 +1,58 @@
+/*
+ =========================================================================================
+ Name        : interrupt.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : Host replacement of avr/interrupt.h , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _HOST_AVR_INTERRUPT_H_
+#define _HOST_AVR_INTERRUPT_H_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include <avr/io.h>
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+/* the ISR is a normal function called by the test (e.g. USART_RXC_vect()) */
+#define ISR(vector)						void vector(void); void vector(void)
+
+/* Global Interrupt Enable/Disable on the host Status Register */
+#define sei()							GLOBAL_INTERRUPT_ENABLE()
+#define cli()							GLOBAL_INTERRUPT_DISABLE()
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+/* ISRs of the drivers (only the enabled ones are defined) */
+void INT0_vect(void);
+void INT1_vect(void);
+void INT2_vect(void);
+void TIMER2_COMP_vect(void);
+void TIMER2_OVF_vect(void);
+void TIMER1_CAPT_vect(void);
+void TIMER1_COMPA_vect(void);
+void TIMER1_COMPB_vect(void);
+void TIMER1_OVF_vect(void);
+void TIMER0_COMP_vect(void);
+void TIMER0_OVF_vect(void);
+void SPI_STC_vect(void);
+void USART_RXC_vect(void);
+void USART_UDRE_vect(void);
+void USART_TXC_vect(void);
+void ADC_vect(void);
+void EE_RDY_vect(void);
+void ANA_COMP_vect(void);
+void TWI_vect(void);
+void SPM_RDY_vect(void);
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _HOST_AVR_INTERRUPT_H_ */
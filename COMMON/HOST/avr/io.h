@@ -0,0 +1,88 @@
+/*
+ =========================================================================================
+ Name        : io.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : Host replacement of avr/io.h , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _HOST_AVR_IO_H_
+#define _HOST_AVR_IO_H_
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * avr/io.h names used by the drivers besides ATmega32.h :
+ * 	- the Registers are mapped to the host register file through IO_REG8 (expanded where they are used)
+ * 	- the bit numbers are the same as the target
+ */
+
+/* --------------------------------- */
+/* TWI */
+
+#define TWCR							IO_REG8(TWCR_ADDRESS)
+#define TWDR							IO_REG8(TWDR_ADDRESS)
+#define TWSR							IO_REG8(TWSR_ADDRESS)
+#define TWBR							IO_REG8(TWBR_ADDRESS)
+
+#define TWIE							0
+#define TWEN							2
+#define TWWC							3
+#define TWSTO							4
+#define TWSTA							5
+#define TWEA							6
+#define TWINT							7
+
+/* --------------------------------- */
+/* SPI */
+
+#define SPCR							IO_REG8(SPCR_ADDRESS)
+#define SPSR							IO_REG8(SPSR_ADDRESS)
+#define SPDR							IO_REG8(SPDR_ADDRESS)
+
+#define SPI2X							0
+#define WCOL							6
+#define SPIF							7
+
+/* --------------------------------- */
+/* USART */
+
+#define MPCM							0
+#define U2X								1
+#define PE								2
+#define DOR								3
+#define FE								4
+#define UDRE							5
+#define TXC								6
+#define RXC								7
+
+#define URSEL							7
+
+/* --------------------------------- */
+/* ADC */
+
+#define ADIE							3
+#define ADIF							4
+#define ADATE							5
+#define ADSC							6
+#define ADEN							7
+
+/* --------------------------------- */
+/* Timers */
+
+#define TOV0							0
+#define OCF0							1
+#define TOV1							2
+#define OCF1B							3
+#define OCF1A							4
+#define ICF1							5
+#define TOV2							6
+#define OCF2							7
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _HOST_AVR_IO_H_ */
@@ -0,0 +1,26 @@
+/*
+ =========================================================================================
+ Name        : pgmspace.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : Host replacement of avr/pgmspace.h , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _HOST_AVR_PGMSPACE_H_
+#define _HOST_AVR_PGMSPACE_H_
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+/* the host has one address space so the flash data is normal const data */
+#define PROGMEM
+#define PSTR(str)						(str)
+#define pgm_read_byte(address)			( *(const unsigned char *)(address) )
+#define pgm_read_word(address)			( *(const unsigned short *)(address) )
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _HOST_AVR_PGMSPACE_H_ */
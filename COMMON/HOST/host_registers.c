@@ -0,0 +1,301 @@
+/*
+ =========================================================================================
+ Name        : host_registers.c
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : Host Register File Source file , Ansi-style
+ =========================================================================================
+*/
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "host_registers.h"
+#include "host_trace.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/* no Register */
+#define HOST_REG_NO_ADDRESS						0xFFFF
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -------------------Global section-------------------- */
+
+/* register file (aligned for the 16-bit Registers TCNT1, OCR1A, OCR1B, ICR1 and ADC) */
+static volatile uint8 host_register_file[HOST_REGISTERS_SIZE] __attribute__((aligned(2)));
+
+/* value of every Register seen by the model (a driver write is a Register which differs from its shadow) */
+static uint8 host_register_shadow[HOST_REGISTERS_SIZE];
+
+/* low byte of a 16-bit Register (accessed with a size of 2 bytes), its writes are counted on the low byte */
+static uint8 host_register_wide[HOST_REGISTERS_SIZE];
+
+/* the write hooks are running (a write hook which accesses a Register doesn't check the writes again) */
+static uint8 host_sync_running = ZERO_INIT;
+
+/* hooks of every Register */
+static host_register_hook_t host_access_hooks[HOST_REGISTERS_SIZE];
+static host_register_hook_t host_write_hooks[HOST_REGISTERS_SIZE];
+
+/* time spent in the delays */
+static float64 host_elapsed_us = 0.0;
+
+/* Register returned for an address out of the register file */
+static volatile uint8 host_dummy_register[2];
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions definition section------------- */
+
+
+/**
+ * @brief  get the host address of a Register (called by every Register access of ATmega32.h) :
+ * 			1- Call the write hooks of the Registers written by the driver since the last access
+ * 			2- Call the access hook of the Register
+ * @param  (address) data memory address of the Register
+ * @param  (size)    size of the Register in bytes
+ * @return the address of the Register in the register file
+ */
+volatile void *HOST_REG_access(uint16 address , uint8 size)
+{
+	/* create a local pointer to hold the address of the Register in the register file */
+	volatile void *l_register = host_dummy_register;
+
+	/* complete the previous accesses */
+	HOST_REG_sync();
+
+	if(address < HOST_REGISTERS_SIZE)
+	{
+		/* the access hook may update the Register before the driver reads it */
+		if(host_access_hooks[address])
+		{
+			(*host_access_hooks[address])( (uint8)address );
+		}
+		else{ /* Nothing */ }
+
+#if HOST_TRACE_CFG_ENABLE
+		HOST_TRACE_onAccess(address , host_register_file[address]);
+#endif
+
+		if(size > 1)
+		{
+			host_register_wide[address] = TRUE;
+		}
+		else{ /* Nothing */ }
+
+		l_register = &host_register_file[address];
+	}
+	else{ /* Nothing */ }
+
+	return l_register;
+}
+
+
+/**
+ * @brief  clear the register file, the hooks and the elapsed time
+ */
+void HOST_REG_reset(void)
+{
+	/* create a local variable to traverse the register file */
+	uint16 l_address = ZERO_INIT;
+
+	for(l_address = 0; l_address < HOST_REGISTERS_SIZE; l_address++)
+	{
+		host_register_file[l_address] = ZERO_INIT;
+		host_register_shadow[l_address] = ZERO_INIT;
+		host_register_wide[l_address] = FALSE;
+		host_access_hooks[l_address] = NULL_PTR;
+		host_write_hooks[l_address] = NULL_PTR;
+	}
+
+	host_elapsed_us = 0.0;
+}
+
+
+/**
+ * @brief  set the hook called before every access of a Register
+ * @param  (address) data memory address of the Register
+ * @param  (hook)    the hook function (NULL_PTR >> no hook)
+ */
+void HOST_REG_setAccessHook(uint8 address , host_register_hook_t hook)
+{
+	if(address < HOST_REGISTERS_SIZE)
+	{
+		host_access_hooks[address] = hook;
+	}
+	else{ /* Nothing */ }
+}
+
+
+/**
+ * @brief  set the hook called when the value of a Register is changed by a driver
+ * @param  (address) data memory address of the Register
+ * @param  (hook)    the hook function (NULL_PTR >> no hook)
+ */
+void HOST_REG_setWriteHook(uint8 address , host_register_hook_t hook)
+{
+	if(address < HOST_REGISTERS_SIZE)
+	{
+		host_write_hooks[address] = hook;
+	}
+	else{ /* Nothing */ }
+}
+
+
+/**
+ * @brief  call the write hooks of the Registers changed by the drivers since the last check (call it after a driver API returns)
+ */
+void HOST_REG_sync(void)
+{
+	/* create a local variable to traverse the register file */
+	uint16 l_address = ZERO_INIT;
+	/* create a local variable to hold the value of the byte before the write */
+	uint8 l_before = ZERO_INIT;
+#if HOST_TRACE_CFG_ENABLE
+	/* create local variables to hold the Register of the byte and the last Register counted by the trace */
+	uint16 l_register = ZERO_INIT;
+	uint16 l_counted = HOST_REG_NO_ADDRESS;
+#endif
+
+	if(!host_sync_running)
+	{
+		host_sync_running = TRUE;
+
+		/* every changed byte is credited to its own Register (an expression may access many Registers before it stores) */
+		for(l_address = 0; l_address < HOST_REGISTERS_SIZE; l_address++)
+		{
+			if(host_register_file[l_address] != host_register_shadow[l_address])
+			{
+				l_before = host_register_shadow[l_address];
+				host_register_shadow[l_address] = host_register_file[l_address];
+
+#if HOST_TRACE_CFG_ENABLE
+				/* a 16-bit Register is counted once on its low byte */
+				l_register = ( (l_address > 0) && (host_register_wide[l_address - 1]) ) ? (l_address - 1) : l_address;
+				if(l_register != l_counted)
+				{
+					HOST_TRACE_onWrite(l_register , l_before , host_register_file[l_address]);
+					l_counted = l_register;
+				}
+				else{ /* Nothing */ }
+#endif
+
+				if(host_write_hooks[l_address])
+				{
+					(*host_write_hooks[l_address])( (uint8)l_address );
+				}
+				else{ /* Nothing */ }
+			}
+			else{ /* Nothing */ }
+		}
+
+		host_sync_running = FALSE;
+	}
+	else{ /* Nothing */ }
+}
+
+
+/**
+ * @brief  read a Register without calling the hooks (test side)
+ * @param  (address) data memory address of the Register
+ * @return the value of the Register
+ */
+uint8 HOST_REG_read(uint8 address)
+{
+	return (address < HOST_REGISTERS_SIZE) ? host_register_file[address] : 0;
+}
+
+
+/**
+ * @brief  write a Register without calling its write hook (test side, the pending driver writes are checked first)
+ * @param  (address) data memory address of the Register
+ * @param  (value)   the value to be written
+ */
+void HOST_REG_write(uint8 address , uint8 value)
+{
+	if(address < HOST_REGISTERS_SIZE)
+	{
+		/* the driver writes before the test write are checked first, the test write isn't a driver write */
+		HOST_REG_sync();
+
+		host_register_file[address] = value;
+		host_register_shadow[address] = value;
+	}
+	else{ /* Nothing */ }
+}
+
+
+/**
+ * @brief  add a delay of util/delay.h to the elapsed time
+ * @param  (us) the delay in micro seconds
+ */
+void HOST_REG_addDelayUs(float64 us)
+{
+	host_elapsed_us += us;
+}
+
+
+/**
+ * @brief  get the time spent in the delays of util/delay.h since the last reset
+ * @return the elapsed time in micro seconds
+ */
+float64 HOST_REG_getElapsedUs(void)
+{
+	return host_elapsed_us;
+}
+
+
+/**
+ * @brief  convert an integer to a string in the required base (avr-libc stdlib.h)
+ * @param  (value) the integer to be converted
+ * @param  (str)   pointer to the string to be filled
+ * @param  (radix) the base (2..36)
+ * @return pointer to the string
+ */
+char *itoa(int value , char *str , int radix)
+{
+	/* create local variables to build the digits in reverse order */
+	char l_digits[sizeof(int) * 8 + 1];
+	uint8 l_count = ZERO_INIT;
+	/* create a local variable to hold the magnitude of the value */
+	unsigned int l_magnitude = (unsigned int)value;
+	/* create a local variable to fill the string */
+	uint8 l_index = ZERO_INIT;
+
+	if( (radix < 2) || (radix > 36) )
+	{
+		str[0] = '\0';
+	}
+	else
+	{
+		/* avr-libc writes a minus sign for negative values in base 10 only */
+		if( (value < 0) && (10 == radix) )
+		{
+			str[l_index++] = '-';
+			l_magnitude = 0u - (unsigned int)value;
+		}
+		else{ /* Nothing */ }
+
+		do
+		{
+			l_digits[l_count++] = "0123456789abcdefghijklmnopqrstuvwxyz"[l_magnitude % (unsigned int)radix];
+			l_magnitude /= (unsigned int)radix;
+		}while(l_magnitude != 0);
+
+		while(l_count > 0)
+		{
+			str[l_index++] = l_digits[--l_count];
+		}
+		str[l_index] = '\0';
+	}
+
+	return str;
+}
+
+
+/* ----------------------------------------------------------------------------------- */
@@ -0,0 +1,139 @@
+/*
+ =========================================================================================
+ Name        : host_registers.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : Host Register File Header file , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _HOST_REGISTERS_H_
+#define _HOST_REGISTERS_H_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "std_types.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * Host Register File (ATMEGA32_HOST_BUILD = ENABLE) :
+ * 	- every Register of ATmega32.h is a byte of a RAM register file indexed by its data memory address (0x20..0x5F)
+ * 	- every Register access of the drivers goes through HOST_REG_access so the peripherals are modeled by hooks :
+ * 		- access hook : called before every access of the Register (e.g. set UDRE before the driver polls UCSRA)
+ * 		- write hook  : called when a driver changed the value of the Register, the register file is compared with
+ * 		  its shadow copy on the next Register access or HOST_REG_sync (writing the value the Register already holds
+ * 		  isn't seen, a model which needs every write clears the Register in its hook, e.g. UDR after the transmission)
+ * 	- plain C on any host : no signal, no page protection (debuggers and sanitizers run as usual)
+ * 	- avr/interrupt.h ISR(vector) becomes the function vector(void) so a test calls the ISR directly (e.g. USART_RXC_vect())
+ * 	- util/delay.h delays don't wait, they are added to HOST_REG_getElapsedUs
+ * 	- host_trace.h counts the Register accesses of a driver API call (HOST_TRACE_begin/HOST_TRACE_end)
+ *
+ * Build :
+ * 	gcc -DATMEGA32_HOST_BUILD=1 -DCPU_TYPE=CPU_TYPE_64 -fno-strict-aliasing -ICOMMON/HOST -ICOMMON -I<driver dirs>
+ * 		COMMON/HOST/host_registers.c COMMON/HOST/host_trace.c <drivers .c> <test .c>
+ */
+
+/* size of the register file (data memory addresses 0x00..0x5F, the I/O Registers are 0x20..0x5F) */
+#define HOST_REGISTERS_SIZE						0x60
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -----user_defined data type declaration section------ */
+
+/* Register hook >> takes the data memory address of the Register */
+typedef void (* host_register_hook_t)(uint8 address);
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  get the host address of a Register (called by every Register access of ATmega32.h) :
+ * 			1- Call the write hooks of the Registers written by the driver since the last access
+ * 			2- Call the access hook of the Register
+ * @param  (address) data memory address of the Register
+ * @param  (size)    size of the Register in bytes
+ * @return the address of the Register in the register file
+ */
+volatile void *HOST_REG_access(uint16 address , uint8 size);
+
+
+/**
+ * @brief  clear the register file, the hooks and the elapsed time
+ */
+void HOST_REG_reset(void);
+
+
+/**
+ * @brief  set the hook called before every access of a Register
+ * @param  (address) data memory address of the Register
+ * @param  (hook)    the hook function (NULL_PTR >> no hook)
+ */
+void HOST_REG_setAccessHook(uint8 address , host_register_hook_t hook);
+
+
+/**
+ * @brief  set the hook called when the value of a Register is changed by a driver
+ * @param  (address) data memory address of the Register
+ * @param  (hook)    the hook function (NULL_PTR >> no hook)
+ */
+void HOST_REG_setWriteHook(uint8 address , host_register_hook_t hook);
+
+
+/**
+ * @brief  call the write hooks of the Registers changed by the drivers since the last check (call it after a driver API returns)
+ */
+void HOST_REG_sync(void);
+
+
+/**
+ * @brief  read a Register without calling the hooks (test side)
+ * @param  (address) data memory address of the Register
+ * @return the value of the Register
+ */
+uint8 HOST_REG_read(uint8 address);
+
+
+/**
+ * @brief  write a Register without calling its write hook (test side, the pending driver writes are checked first)
+ * @param  (address) data memory address of the Register
+ * @param  (value)   the value to be written
+ */
+void HOST_REG_write(uint8 address , uint8 value);
+
+
+/**
+ * @brief  add a delay of util/delay.h to the elapsed time
+ * @param  (us) the delay in micro seconds
+ */
+void HOST_REG_addDelayUs(float64 us);
+
+
+/**
+ * @brief  get the time spent in the delays of util/delay.h since the last reset
+ * @return the elapsed time in micro seconds
+ */
+float64 HOST_REG_getElapsedUs(void);
+
+
+/* --------------------------------- */
+/* avr-libc functions which the host C library doesn't have */
+
+/**
+ * @brief  convert an integer to a string in the required base (avr-libc stdlib.h)
+ * @param  (value) the integer to be converted
+ * @param  (str)   pointer to the string to be filled
+ * @param  (radix) the base (2..36)
+ * @return pointer to the string
+ */
+char *itoa(int value , char *str , int radix);
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _HOST_REGISTERS_H_ */
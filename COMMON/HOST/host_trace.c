@@ -0,0 +1,307 @@
+/*
+ =========================================================================================
+ Name        : host_trace.c
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : Host Register Access Trace Source file , Ansi-style
+ =========================================================================================
+*/
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "host_trace.h"
+#include "host_registers.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -------------------Global section-------------------- */
+
+/* names of the I/O Registers (data memory address 0x20..0x5F, the 16-bit Registers are named by their low byte) */
+static const char *const host_register_names[HOST_REGISTERS_SIZE] =
+{
+	[0x20] = "TWBR",   [0x21] = "TWSR",   [0x22] = "TWAR",   [0x23] = "TWDR",
+	[0x24] = "ADCL",   [0x25] = "ADCH",   [0x26] = "ADCSRA", [0x27] = "ADMUX",
+	[0x28] = "ACSR",   [0x29] = "UBRRL",  [0x2A] = "UCSRB",  [0x2B] = "UCSRA",
+	[0x2C] = "UDR",    [0x2D] = "SPCR",   [0x2E] = "SPSR",   [0x2F] = "SPDR",
+	[0x30] = "PIND",   [0x31] = "DDRD",   [0x32] = "PORTD",  [0x33] = "PINC",
+	[0x34] = "DDRC",   [0x35] = "PORTC",  [0x36] = "PINB",   [0x37] = "DDRB",
+	[0x38] = "PORTB",  [0x39] = "PINA",   [0x3A] = "DDRA",   [0x3B] = "PORTA",
+	[0x3C] = "EECR",   [0x3D] = "EEDR",   [0x3E] = "EEARL",  [0x3F] = "EEARH",
+	[0x40] = "UBRRH/UCSRC",               [0x41] = "WDTCR",  [0x42] = "ASSR",
+	[0x43] = "OCR2",   [0x44] = "TCNT2",  [0x45] = "TCCR2",  [0x46] = "ICR1L",
+	[0x47] = "ICR1H",  [0x48] = "OCR1BL", [0x49] = "OCR1BH", [0x4A] = "OCR1AL",
+	[0x4B] = "OCR1AH", [0x4C] = "TCNT1L", [0x4D] = "TCNT1H", [0x4E] = "TCCR1B",
+	[0x4F] = "TCCR1A", [0x50] = "SFIOR",  [0x51] = "OSCCAL", [0x52] = "TCNT0",
+	[0x53] = "TCCR0",  [0x54] = "MCUCSR", [0x55] = "MCUCR",  [0x56] = "TWCR",
+	[0x57] = "SPMCR",  [0x58] = "TIFR",   [0x59] = "TIMSK",  [0x5A] = "GIFR",
+	[0x5B] = "GICR",   [0x5C] = "OCR0",   [0x5D] = "SPL",    [0x5E] = "SPH",
+	[0x5F] = "SREG"
+};
+
+/* name of the traced API (NULL_PTR >> no running trace) */
+static const char *host_trace_api = NULL_PTR;
+
+/* counters of every Register and the totals (the reads are the accesses which didn't change their Register) */
+static uint32 host_trace_accesses[HOST_REGISTERS_SIZE];
+static uint32 host_trace_writes[HOST_REGISTERS_SIZE];
+static uint32 host_trace_total_accesses = 0;
+static uint32 host_trace_total_writes = 0;
+
+/* trace log Enable/Disable */
+static uint8 host_trace_log = HOST_TRACE_LOG_DISABLE;
+
+/* output of the summaries and the log (NULL_PTR >> stdout) */
+static FILE *host_trace_output = NULL_PTR;
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  get the output of the summaries and the log
+ * @return the output stream
+ */
+static FILE *HOST_TRACE_getOutput(void);
+
+
+/**
+ * @brief  print the name of a Register (or its address if it has no name)
+ * @param  (address) data memory address of the Register
+ */
+static void HOST_TRACE_printName(uint16 address);
+
+
+/**
+ * @brief  get the reads of a Register : its accesses which didn't change it
+ * @param  (address) data memory address of the Register
+ * @return number of reads
+ */
+static uint32 HOST_TRACE_getRegisterReads(uint16 address);
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions definition section------------- */
+
+
+/**
+ * @brief  start counting the Register accesses of an API call
+ * @param  (api_name) name of the traced API (printed in the summary)
+ */
+void HOST_TRACE_begin(const char *api_name)
+{
+	/* create a local variable to traverse the counters */
+	uint16 l_address = ZERO_INIT;
+
+	/* the accesses done before the API call are not counted */
+	HOST_REG_sync();
+
+	for(l_address = 0; l_address < HOST_REGISTERS_SIZE; l_address++)
+	{
+		host_trace_accesses[l_address] = ZERO_INIT;
+		host_trace_writes[l_address] = ZERO_INIT;
+	}
+	host_trace_total_accesses = ZERO_INIT;
+	host_trace_total_writes = ZERO_INIT;
+
+	host_trace_api = (NULL_PTR == api_name) ? "?" : api_name;
+
+	if(HOST_TRACE_LOG_ENABLE == host_trace_log)
+	{
+		fprintf(HOST_TRACE_getOutput() , "%s:\n" , host_trace_api);
+	}
+	else{ /* Nothing */ }
+}
+
+
+/**
+ * @brief  stop counting and print the summary of the API call
+ */
+void HOST_TRACE_end(void)
+{
+	/* create a local variable to traverse the counters */
+	uint16 l_address = ZERO_INIT;
+	/* create a local variable to hold the output stream */
+	FILE *l_output = HOST_TRACE_getOutput();
+
+	if(NULL_PTR != host_trace_api)
+	{
+		/* complete the last access of the API call */
+		HOST_REG_sync();
+
+		fprintf(l_output , "%s: accesses=%lu reads=%lu writes=%lu |" , host_trace_api ,
+				(unsigned long)host_trace_total_accesses , (unsigned long)HOST_TRACE_getReads() ,
+				(unsigned long)host_trace_total_writes);
+
+		for(l_address = 0; l_address < HOST_REGISTERS_SIZE; l_address++)
+		{
+			if(host_trace_accesses[l_address] > 0)
+			{
+				fputc(' ' , l_output);
+				HOST_TRACE_printName(l_address);
+				fprintf(l_output , "=%lu/%lu/%lu" , (unsigned long)host_trace_accesses[l_address] ,
+						(unsigned long)HOST_TRACE_getRegisterReads(l_address) , (unsigned long)host_trace_writes[l_address]);
+			}
+			else{ /* Nothing */ }
+		}
+		fputc('\n' , l_output);
+
+		/* the counters are kept for HOST_TRACE_getAccesses/HOST_TRACE_getReads/HOST_TRACE_getWrites */
+		host_trace_api = NULL_PTR;
+	}
+	else{ /* Nothing */ }
+}
+
+
+/**
+ * @brief  Enable/Disable printing every Register access
+ * @param  (log_enable) >> @ref : Trace Log Enable/Disable
+ */
+void HOST_TRACE_setLog(uint8 log_enable)
+{
+	host_trace_log = log_enable;
+}
+
+
+/**
+ * @brief  select the output of the summaries and the log (stdout by default)
+ * @param  (output) the output stream
+ */
+void HOST_TRACE_setOutput(FILE *output)
+{
+	host_trace_output = output;
+}
+
+
+/**
+ * @brief  get the accesses counted by the last HOST_TRACE_end (or the running trace)
+ * @return number of Register accesses
+ */
+uint32 HOST_TRACE_getAccesses(void)
+{
+	return host_trace_total_accesses;
+}
+
+
+/**
+ * @brief  get the reads counted by the last HOST_TRACE_end (or the running trace)
+ * @return number of the accesses which didn't change their Register
+ */
+uint32 HOST_TRACE_getReads(void)
+{
+	/* create a local variable to traverse the counters */
+	uint16 l_address = ZERO_INIT;
+	/* create a local variable to hold the reads of all the Registers */
+	uint32 l_reads = ZERO_INIT;
+
+	for(l_address = 0; l_address < HOST_REGISTERS_SIZE; l_address++)
+	{
+		l_reads += HOST_TRACE_getRegisterReads(l_address);
+	}
+
+	return l_reads;
+}
+
+
+/**
+ * @brief  get the writes counted by the last HOST_TRACE_end (or the running trace)
+ * @return number of the Register changes
+ */
+uint32 HOST_TRACE_getWrites(void)
+{
+	return host_trace_total_writes;
+}
+
+
+/**
+ * @brief  count an access of a Register (called by HOST_REG_access)
+ * @param  (address) data memory address of the Register
+ * @param  (value)   value of the Register before the access
+ */
+void HOST_TRACE_onAccess(uint16 address , uint8 value)
+{
+	if( (NULL_PTR != host_trace_api) && (address < HOST_REGISTERS_SIZE) )
+	{
+		host_trace_accesses[address]++;
+		host_trace_total_accesses++;
+
+		if(HOST_TRACE_LOG_ENABLE == host_trace_log)
+		{
+			fputs("  " , HOST_TRACE_getOutput());
+			HOST_TRACE_printName(address);
+			fprintf(HOST_TRACE_getOutput() , " 0x%02X\n" , (unsigned int)value);
+		}
+		else{ /* Nothing */ }
+	}
+	else{ /* Nothing */ }
+}
+
+
+/**
+ * @brief  count a write of a Register (called by HOST_REG_sync when the Register is changed)
+ * @param  (address) data memory address of the Register
+ * @param  (before)  value before the write
+ * @param  (after)   value after the write
+ */
+void HOST_TRACE_onWrite(uint16 address , uint8 before , uint8 after)
+{
+	if( (NULL_PTR != host_trace_api) && (address < HOST_REGISTERS_SIZE) )
+	{
+		host_trace_writes[address]++;
+		host_trace_total_writes++;
+
+		if(HOST_TRACE_LOG_ENABLE == host_trace_log)
+		{
+			fputs("  " , HOST_TRACE_getOutput());
+			HOST_TRACE_printName(address);
+			fprintf(HOST_TRACE_getOutput() , " w 0x%02X -> 0x%02X\n" , (unsigned int)before , (unsigned int)after);
+		}
+		else{ /* Nothing */ }
+	}
+	else{ /* Nothing */ }
+}
+
+
+/**
+ * @brief  get the output of the summaries and the log
+ * @return the output stream
+ */
+static FILE *HOST_TRACE_getOutput(void)
+{
+	return (NULL_PTR == host_trace_output) ? stdout : host_trace_output;
+}
+
+
+/**
+ * @brief  print the name of a Register (or its address if it has no name)
+ * @param  (address) data memory address of the Register
+ */
+static void HOST_TRACE_printName(uint16 address)
+{
+	if(NULL_PTR != host_register_names[address])
+	{
+		fputs(host_register_names[address] , HOST_TRACE_getOutput());
+	}
+	else
+	{
+		fprintf(HOST_TRACE_getOutput() , "0x%02X" , (unsigned int)address);
+	}
+}
+
+
+/**
+ * @brief  get the reads of a Register : its accesses which didn't change it
+ * @param  (address) data memory address of the Register
+ * @return number of reads
+ */
+static uint32 HOST_TRACE_getRegisterReads(uint16 address)
+{
+	return (host_trace_accesses[address] > host_trace_writes[address]) ?
+		   (host_trace_accesses[address] - host_trace_writes[address]) : 0;
+}
+
+
+/* ----------------------------------------------------------------------------------- */
@@ -0,0 +1,123 @@
+/*
+ =========================================================================================
+ Name        : host_trace.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : Host Register Access Trace Header file , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _HOST_TRACE_H_
+#define _HOST_TRACE_H_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include <stdio.h>
+
+#include "std_types.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * Host Register Access Trace (host build only) :
+ * 	- HOST_TRACE_begin("API") ... HOST_TRACE_end() count every Register access done by the driver code in between
+ * 	- an access is one use of a Register of ATmega32.h (_UCSRB._RXEN = x, _UDR.Byte, IO_REG8(...))
+ * 	- a write is a change of the value of a Register found by the register file (credited to the changed Register,
+ * 	  a 16-bit Register is counted once), a read is an access which didn't change its Register :
+ * 		x = _UDR.Byte >> 1 read , _UDR.Byte = x >> 1 write (1 read if the value isn't changed) , _UCSRB._RXEN = x >> 1 write
+ * 	- HOST_TRACE_end prints a one line summary sorted by Register address, so the summaries of two revisions are diffed :
+ * 		UART_init: accesses=27 reads=15 writes=12 | UBRRL=1/0/1 UCSRB=9/8/1 ...   (Register=accesses/reads/writes)
+ * 	- the log mode prints every access and every write : "  UCSRB 0x00" , "  UCSRB w 0x00 -> 0x10"
+ */
+
+/* --------------------------------- */
+/* Trace Configurations Enable/Disable (DISABLE >> HOST_REG_access has no trace overhead) */
+
+#ifndef HOST_TRACE_CFG_ENABLE
+#define HOST_TRACE_CFG_ENABLE					ENABLE
+#endif
+
+/* --------------------------------- */
+/* @ref : Trace Log Enable/Disable */
+
+#define HOST_TRACE_LOG_DISABLE					0
+#define HOST_TRACE_LOG_ENABLE					1
+
+/* --------------------------------- */
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  start counting the Register accesses of an API call
+ * @param  (api_name) name of the traced API (printed in the summary)
+ */
+void HOST_TRACE_begin(const char *api_name);
+
+
+/**
+ * @brief  stop counting and print the summary of the API call
+ */
+void HOST_TRACE_end(void);
+
+
+/**
+ * @brief  Enable/Disable printing every Register access
+ * @param  (log_enable) >> @ref : Trace Log Enable/Disable
+ */
+void HOST_TRACE_setLog(uint8 log_enable);
+
+
+/**
+ * @brief  select the output of the summaries and the log (stdout by default)
+ * @param  (output) the output stream
+ */
+void HOST_TRACE_setOutput(FILE *output);
+
+
+/**
+ * @brief  get the accesses counted by the last HOST_TRACE_end (or the running trace)
+ * @return number of Register accesses
+ */
+uint32 HOST_TRACE_getAccesses(void);
+
+
+/**
+ * @brief  get the reads counted by the last HOST_TRACE_end (or the running trace)
+ * @return number of the accesses which didn't change their Register
+ */
+uint32 HOST_TRACE_getReads(void);
+
+
+/**
+ * @brief  get the writes counted by the last HOST_TRACE_end (or the running trace)
+ * @return number of the Register changes
+ */
+uint32 HOST_TRACE_getWrites(void);
+
+
+/**
+ * @brief  count an access of a Register (called by HOST_REG_access)
+ * @param  (address) data memory address of the Register
+ * @param  (value)   value of the Register before the access
+ */
+void HOST_TRACE_onAccess(uint16 address , uint8 value);
+
+
+/**
+ * @brief  count a write of a Register (called by HOST_REG_sync when the Register is changed)
+ * @param  (address) data memory address of the Register
+ * @param  (before)  value before the write
+ * @param  (after)   value after the write
+ */
+void HOST_TRACE_onWrite(uint16 address , uint8 before , uint8 after);
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _HOST_TRACE_H_ */
@@ -0,0 +1,29 @@
+/*
+ =========================================================================================
+ Name        : delay.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : Host replacement of util/delay.h , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _HOST_UTIL_DELAY_H_
+#define _HOST_UTIL_DELAY_H_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "host_registers.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+/* the delays don't wait, they are added to the elapsed time >> @ref : HOST_REG_getElapsedUs */
+#define _delay_us(us)					HOST_REG_addDelayUs( (float64)(us) )
+#define _delay_ms(ms)					HOST_REG_addDelayUs( (float64)(ms) * 1000.0 )
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _HOST_UTIL_DELAY_H_ */
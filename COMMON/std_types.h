@@ -65,7 +65,10 @@
 #define CPU_TYPE_64 	64
 
 
+/* the CPU type may be given by the build (e.g. -DCPU_TYPE=CPU_TYPE_64 for a 64-bit host build) */
+#ifndef CPU_TYPE
 #define CPU_TYPE 		CPU_TYPE_8
+#endif
 
 /* ----------------------------------------------------------------------------------- */
 /* status of the performed operation */
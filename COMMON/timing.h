@@ -0,0 +1,98 @@
+/*
+ =========================================================================================
+ Name        : timing.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : MCU Frequency and Integer Timing Calculations Header file , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _TIMING_H_
+#define _TIMING_H_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "std_types.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * Integer Timing Calculations :
+ * 	- every calculation is integer so the drivers don't link the floating point library
+ * 	- with constant arguments the macros are folded by the compiler (no code is generated),
+ * 	  with variable arguments they cost one 32-bit multiplication and/or division
+ * 	- the results are truncated as the casts of the floating point calculations they replace
+ * 	  (except the USART Baud Rate solver which rounds to the nearest UBRR)
+ */
+
+/* MCU Frequency (F_CPU) in Hz (may be given by the build, e.g. -DCPU_FREQUENCY=16000000UL) */
+#ifndef CPU_FREQUENCY
+#define CPU_FREQUENCY							8000000UL
+#endif
+
+/* MCU Frequency in kHz */
+#define CPU_FREQUENCY_KHZ						( (CPU_FREQUENCY) / 1000UL )
+
+#if ( (CPU_FREQUENCY) % 1000UL ) != 0
+#error "CPU_FREQUENCY must be a multiple of 1 kHz for the integer timing calculations"
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+/* --------------------------------- */
+/* Timer ticks and time (prescaler >> the clock divider of the timer : 1, 8, 64, 256, 1024) */
+
+/* number of timer ticks in a time in micro seconds (time * F_CPU / prescaler), time up to 268 ms at 16 MHz */
+#define TIMING_US_TO_TICKS(US,PRESCALER)		( ( (uint32)(US) * (CPU_FREQUENCY_KHZ) ) / ( 1000UL * (uint32)(PRESCALER) ) )
+
+/* time in micro seconds of a number of timer ticks (ticks * prescaler / F_CPU), ticks * prescaler up to 4.29 million */
+#define TIMING_TICKS_TO_US(TICKS,PRESCALER)		( ( (uint32)(TICKS) * (uint32)(PRESCALER) * 1000UL ) / (CPU_FREQUENCY_KHZ) )
+
+/* --------------------------------- */
+/* Duty cycle (percent >> 0..100) */
+
+/* Q16 fixed point scale of (top / 100), rounded up so (percent * scale) >> 16 equals (percent * top) / 100 for any 16-bit top */
+#define TIMING_PERCENT_SCALE(TOP)				( ( (uint32)(TOP) * 65536UL + 99UL ) / 100UL )
+
+/* percent of the top using a scale of TIMING_PERCENT_SCALE (a multiplication and a shift instead of a division) */
+#define TIMING_PERCENT_OF(PERCENT,SCALE)		( (uint16)( ( (uint32)(PERCENT) * (SCALE) ) >> 16 ) )
+
+/* --------------------------------- */
+/* Communication peripherals (truncated as the datasheet formulas) */
+
+/* TWI Bit Rate Register value : (F_CPU / SCL - 16) / (2 * 4^TWPS) (twps >> the TWI Prescaler Bits 0..3) */
+#define TIMING_TWBR(SCL,TWPS)					( (uint8)( ( ( (CPU_FREQUENCY) / (uint32)(SCL) ) - 16 ) >> ( 1 + ( 2 * (TWPS) ) ) ) )
+
+/* --------------------------------- */
+/* USART Baud Rate solver (rounded, without casts so the macros can be used by #if with a plain number baud rate) */
+/* divisor >> 16 for normal speed, 8 for double speed (U2X) , error >> in 0.01 % of the baud rate (200 >> 2.00 %) */
+
+/* UBRR + 1 rounded to the nearest : F_CPU / (divisor * baud) , limited to the 12-bit UBRR (1..4096) */
+#define TIMING_UBRR_ROUNDED_DIVIDER(BAUD,DIVISOR)	( ( (CPU_FREQUENCY) + ( (DIVISOR) * 1UL * (BAUD) ) / 2UL ) / ( (DIVISOR) * 1UL * (BAUD) ) )
+#define TIMING_UBRR_DIVIDER(BAUD,DIVISOR)			( ( TIMING_UBRR_ROUNDED_DIVIDER(BAUD,DIVISOR) < 1UL ) ? 1UL : \
+													  ( TIMING_UBRR_ROUNDED_DIVIDER(BAUD,DIVISOR) > 4096UL ) ? 4096UL : TIMING_UBRR_ROUNDED_DIVIDER(BAUD,DIVISOR) )
+
+/* CPU cycles of (baud) bit cells with the rounded UBRR : divisor * (UBRR + 1) * baud (F_CPU if the baud rate is exact) */
+#define TIMING_BAUD_CYCLES(BAUD,DIVISOR)			( (DIVISOR) * 1UL * TIMING_UBRR_DIVIDER(BAUD,DIVISOR) * (BAUD) )
+
+/* absolute error of the generated baud rate : | F_CPU - cycles | / cycles */
+#define TIMING_BAUD_ERROR(BAUD,DIVISOR)				( ( ( (CPU_FREQUENCY) > TIMING_BAUD_CYCLES(BAUD,DIVISOR) ) ? \
+														( (CPU_FREQUENCY) - TIMING_BAUD_CYCLES(BAUD,DIVISOR) ) : \
+														( TIMING_BAUD_CYCLES(BAUD,DIVISOR) - (CPU_FREQUENCY) ) ) / ( TIMING_BAUD_CYCLES(BAUD,DIVISOR) / 10000UL ) )
+
+/* speed with the lowest error (normal speed on a tie as the receiver samples each bit more times) : 0 >> normal , 1 >> double (U2X) */
+#define TIMING_BAUD_U2X(BAUD)						( ( TIMING_BAUD_ERROR(BAUD,8) < TIMING_BAUD_ERROR(BAUD,16) ) ? 1 : 0 )
+
+/* UBRR value and error of the speed with the lowest error */
+#define TIMING_BAUD_UBRR(BAUD)						( TIMING_UBRR_DIVIDER(BAUD, ( TIMING_BAUD_U2X(BAUD) ? 8 : 16 ) ) - 1UL )
+#define TIMING_BAUD_BEST_ERROR(BAUD)				( TIMING_BAUD_U2X(BAUD) ? TIMING_BAUD_ERROR(BAUD,8) : TIMING_BAUD_ERROR(BAUD,16) )
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _TIMING_H_ */
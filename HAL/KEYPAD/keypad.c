@@ -16,6 +16,32 @@
 #include "util/delay.h"				/* To use the delay functions */
 
 
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+#if KEYPAD_CONFIG_PIN_GROUPS
+/* logic of the columns group when no button is pressed */
+#if KEYPAD_CONFIG_PULL_UP
+#define KEYPAD_COLUMNS_IDLE			( (1 << KEYPAD_COLUMN_MAX_SIZE) - 1 )
+#endif
+#if KEYPAD_CONFIG_PULL_DOWN
+#define KEYPAD_COLUMNS_IDLE			0x00
+#endif
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+/* keypad row/column pin object */
+#define KEYPAD_ROW(KEYPAD_OBJ,ROW)				( (KEYPAD_OBJ)->rows[ROW] )
+#if KEYPAD_CONFIG_PIN_GROUPS
+#define KEYPAD_COLUMN(KEYPAD_OBJ,COLUMN)		( (KEYPAD_OBJ)->columns.pins[COLUMN] )
+#else
+#define KEYPAD_COLUMN(KEYPAD_OBJ,COLUMN)		( (KEYPAD_OBJ)->columns[COLUMN] )
+#endif
+
+
 /* ----------------------------------------------------------------------------------- */
 /* -------------------Global section-------------------- */
 
@@ -28,7 +54,7 @@
 /* it will be active if the Proteus mode is activated */
 /* NOTE: Proteus mode and Eta32_mini mode can't be activated at the same time */
 #if KEYPAD_CONFIG_PROTEUS
-const static uint8 keypad_pattern[KEYPAD_ROW_MAX_SIZE][KEYPAD_COLUMN_MAX_SIZE] =	{	{'1' , '2' , '3'},
+const uint8 keypad_pattern[KEYPAD_ROW_MAX_SIZE][KEYPAD_COLUMN_MAX_SIZE] =	{	{'1' , '2' , '3'},
 																						{'4' , '5' , '6'},
 																						{'7' , '8' , '9'},
 																						{'*' , '0' , '#'}
@@ -38,7 +64,7 @@ const static uint8 keypad_pattern[KEYPAD_ROW_MAX_SIZE][KEYPAD_COLUMN_MAX_SIZE] =
 /* it will be active if the Eta32_mini mode is activated */
 /* NOTE: Proteus mode and Eta32_mini mode can't be activated at the same time */
 #if KEYPAD_CONFIG_ETA32_KIT
-const static uint8 keypad_pattern[KEYPAD_ROW_MAX_SIZE][KEYPAD_COLUMN_MAX_SIZE] =	{	{0 , 1 , 2 },
+const uint8 keypad_pattern[KEYPAD_ROW_MAX_SIZE][KEYPAD_COLUMN_MAX_SIZE] =	{	{0 , 1 , 2 },
 																						{3 , 4 , 5 },
 																						{6 , 7 , 8 },
 																						{9 ,10 , 11}
@@ -56,7 +82,7 @@ const static uint8 keypad_pattern[KEYPAD_ROW_MAX_SIZE][KEYPAD_COLUMN_MAX_SIZE] =
 /* it will be active if the Proteus mode is activated */
 /* NOTE: Proteus mode and Eta32_mini mode can't be activated at the same time */
 #if KEYPAD_CONFIG_PROTEUS
-const static uint8 keypad_pattern[KEYPAD_ROW_MAX_SIZE][KEYPAD_COLUMN_MAX_SIZE] =	{	{'7' , '8' , '9' , '/'},
+const uint8 keypad_pattern[KEYPAD_ROW_MAX_SIZE][KEYPAD_COLUMN_MAX_SIZE] =	{	{'7' , '8' , '9' , '/'},
 																						{'4' , '5' , '6' , '*'},
 																						{'1' , '2' , '3' , '-'},
 																						{'C' , '0' , '=' , '+'}
@@ -66,7 +92,7 @@ const static uint8 keypad_pattern[KEYPAD_ROW_MAX_SIZE][KEYPAD_COLUMN_MAX_SIZE] =
 /* it will be active if the Eta32_mini mode is activated */
 /* NOTE: Proteus mode and Eta32_mini mode can't be activated at the same time */
 #if KEYPAD_CONFIG_ETA32_KIT
-const static uint8 keypad_pattern[KEYPAD_ROW_MAX_SIZE][KEYPAD_COLUMN_MAX_SIZE] =	{	{0 , 1 , 2 , 3 },
+const uint8 keypad_pattern[KEYPAD_ROW_MAX_SIZE][KEYPAD_COLUMN_MAX_SIZE] =	{	{0 , 1 , 2 , 3 },
 																						{4 , 5 , 6 , 7 },
 																						{8 , 9 , 10, 11},
 																						{12, 13, 14, 15}
@@ -77,10 +103,77 @@ const static uint8 keypad_pattern[KEYPAD_ROW_MAX_SIZE][KEYPAD_COLUMN_MAX_SIZE] =
 /* --------------------------------- */
 
 
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  set the row pin to be output and drive it with the pressed logic
+ * @param  (keypad_obj) 	pointer to the keypad object passed by reference
+ * @param  (row)			holds the index of the row >> @ref : keypad rows/columns index
+ */
+static void KEYPAD_activateRow(keypad_config_t *keypad_obj,uint8 row);
+
+
+/**
+ * @brief  set the row pin again to be input without internal pull up resistance
+ * @param  (keypad_obj) 	pointer to the keypad object passed by reference
+ * @param  (row)			holds the index of the row >> @ref : keypad rows/columns index
+ */
+static void KEYPAD_deactivateRow(keypad_config_t *keypad_obj,uint8 row);
+
+
+/**
+ * @brief  read the logic of the column pin
+ * @param  (keypad_obj) 	pointer to the keypad object passed by reference
+ * @param  (column)			holds the index of the column >> @ref : keypad rows/columns index
+ * @return (logic)    		the logic status of the column pin >> @ref : KEYPAD_PRESSED / KEYPAD_RELEASED
+ */
+static uint8 KEYPAD_readColumn(keypad_config_t *keypad_obj,uint8 column);
+
+
 /* ----------------------------------------------------------------------------------- */
 /* ------------functions definition section------------- */
 
 
+#if KEYPAD_CONFIG_PIN_GROUPS
+/**
+ * @brief  initialize the keypad columns pin group :
+ * 				1- Setup the size of the columns group
+ * 				2- Initialize the columns group through the GPIO Driver
+ * @param  (keypad_obj) 	pointer to the keypad object passed by reference
+ * @return (l_status) 		status of the performed operation
+ *              (E_NOT_OK)  	operation failed
+ *              (E_OK)      	operation success
+ */
+Std_ReturnType KEYPAD_init(keypad_config_t *keypad_obj)
+{
+	/* create a local variable to hold the status of the performed operation */
+	Std_ReturnType l_status = ZERO_INIT;
+
+	/* check if the address is valid or not */
+	if(keypad_obj == NULL_PTR)
+	{
+		/* NULL pointer is passed */
+
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		/* the address passed is valid */
+
+		/* setup the size of the columns group */
+		keypad_obj->columns.size = KEYPAD_COLUMN_MAX_SIZE;
+
+		/* initialize the columns group */
+		l_status = GPIO_busInit( &(keypad_obj->columns) );
+	}
+
+	return l_status;
+}
+#endif
+
+
 /**
  * @brief  get the value of the pressed button in the keypad
  * @param  (keypad_obj) 	pointer to the keypad object passed by reference
@@ -94,63 +187,60 @@ uint8 KEYPAD_getPressedKey(keypad_config_t *keypad_obj)
 
 	uint8 row_counter = ZERO_INIT;
 	uint8 column_counter = ZERO_INIT;
+	/* create a local variable to hold if a button may be pressed in the current row (the columns are checked one by one) */
+	uint8 row_pressed = TRUE;
 
 	/* --------------------------------- */
 	/* set all the pins connected to the keypad to be input */
 
 	/* rows */
-	GPIO_setupPinDirection( &(keypad_obj->rows[KEYPAD_ROW_1]) );
-	GPIO_setupPinDirection( &(keypad_obj->rows[KEYPAD_ROW_2]) );
-	GPIO_setupPinDirection( &(keypad_obj->rows[KEYPAD_ROW_3]) );
-	GPIO_setupPinDirection( &(keypad_obj->rows[KEYPAD_ROW_4]) );
+	GPIO_setupPinsFromTable( &KEYPAD_ROW(keypad_obj,KEYPAD_ROW_1) , KEYPAD_ROW_MAX_SIZE );
 
 	/* columns */
-	GPIO_setupPinDirection( &(keypad_obj->columns[KEYPAD_COLUMN_1]) );
-	GPIO_setupPinDirection( &(keypad_obj->columns[KEYPAD_COLUMN_2]) );
-	GPIO_setupPinDirection( &(keypad_obj->columns[KEYPAD_COLUMN_3]) );
-	/* column 4 in 4x4 mode */
-	#if KEYPAD_CONFIG_4X4_MODE
-	GPIO_setupPinDirection( &(keypad_obj->columns[KEYPAD_COLUMN_4]) );
-	#endif
+	GPIO_setupPinsFromTable( &KEYPAD_COLUMN(keypad_obj,KEYPAD_COLUMN_1) , KEYPAD_COLUMN_MAX_SIZE );
 
 	/* --------------------------------- */
 	/* loop for rows */
 	for(row_counter = 0; row_counter < KEYPAD_ROW_MAX_SIZE; row_counter++)
 	{
-		/* set the current row pin to be output */
-		keypad_obj->rows[row_counter].mode = GPIO_MODE_OUTPUT;
-		GPIO_setupPinDirection( &(keypad_obj->rows[row_counter]) );
+		/* set the current row pin to be output and Set/Clear it */
+		KEYPAD_activateRow(keypad_obj,row_counter);
 
-		/* Set/Clear the row output pin */
-		GPIO_writePin( &(keypad_obj->rows[row_counter]) , KEYPAD_PRESSED );
+		#if KEYPAD_CONFIG_PIN_GROUPS
+		/* read all the columns in one step and check the columns one by one only if a button is pressed in this row */
+		row_pressed = ( GPIO_busRead( &(keypad_obj->columns) ) != KEYPAD_COLUMNS_IDLE );
+		#endif
 
-		/* loop for columns */
-		for(column_counter = 0; column_counter < KEYPAD_COLUMN_MAX_SIZE; column_counter++)
+		if(row_pressed)
 		{
-			/* Check if the button is pressed in this column */
-			if( GPIO_readPin( &(keypad_obj->columns[column_counter]) ) == KEYPAD_PRESSED )
+			/* loop for columns */
+			for(column_counter = 0; column_counter < KEYPAD_COLUMN_MAX_SIZE; column_counter++)
 			{
-				/* keypad button is pressed */
-				/* wait for 30ms for button de-bounce and check if the button is still pressed */
-				_delay_ms(30);
-
-				if( GPIO_readPin( &(keypad_obj->columns[column_counter]) ) == KEYPAD_PRESSED )
+				/* Check if the button is pressed in this column */
+				if( KEYPAD_readColumn(keypad_obj,column_counter) == KEYPAD_PRESSED )
 				{
 					/* keypad button is pressed */
-					keypad_val = keypad_pattern[row_counter][column_counter];
-				}
+					/* wait for 30ms for button de-bounce and check if the button is still pressed */
+					_delay_ms(30);
+
+					if( KEYPAD_readColumn(keypad_obj,column_counter) == KEYPAD_PRESSED )
+					{
+						/* keypad button is pressed */
+						keypad_val = keypad_pattern[row_counter][column_counter];
+					}
 
-				/* single pressing */
-				while(GPIO_readPin( &(keypad_obj->columns[column_counter]) ) == KEYPAD_PRESSED);
+					/* single pressing */
+					while(KEYPAD_readColumn(keypad_obj,column_counter) == KEYPAD_PRESSED);
 
-				/* keypad button is pressed */
-				return keypad_val;
+					/* keypad button is pressed */
+					return keypad_val;
+				}
 			}
 		}
+		else{ /* Nothing */ }
 
 		/* set the current row pin again to be input */
-		keypad_obj->rows[row_counter].mode = GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES;
-		GPIO_setupPinDirection( &(keypad_obj->rows[row_counter]) );
+		KEYPAD_deactivateRow(keypad_obj,row_counter);
 
 		/* Add small delay to fix CPU load issue in proteus */
 		_delay_ms(5);
@@ -162,4 +252,133 @@ uint8 KEYPAD_getPressedKey(keypad_config_t *keypad_obj)
 }
 
 
+/**
+ * @brief  set the row pin to be output and drive it with the pressed logic
+ * @param  (keypad_obj) 	pointer to the keypad object passed by reference
+ * @param  (row)			holds the index of the row >> @ref : keypad rows/columns index
+ */
+static void KEYPAD_activateRow(keypad_config_t *keypad_obj,uint8 row)
+{
+#if KEYPAD_CONFIG_STATIC_PINS
+	/* the keypad object isn't used as the pins are fixed at compile time */
+	(void)keypad_obj;
+
+	/* the keypad pins are fixed at compile time so they are driven through the GPIO fast path */
+	switch(row)
+	{
+		case KEYPAD_ROW_1	:	GPIO_SET_OUTPUT(KEYPAD_ROW_1_PORT_INDEX,KEYPAD_ROW_1_PIN_INDEX);
+								GPIO_WRITE(KEYPAD_ROW_1_PORT_INDEX,KEYPAD_ROW_1_PIN_INDEX,KEYPAD_PRESSED);
+								break;
+
+		case KEYPAD_ROW_2	:	GPIO_SET_OUTPUT(KEYPAD_ROW_2_PORT_INDEX,KEYPAD_ROW_2_PIN_INDEX);
+								GPIO_WRITE(KEYPAD_ROW_2_PORT_INDEX,KEYPAD_ROW_2_PIN_INDEX,KEYPAD_PRESSED);
+								break;
+
+		case KEYPAD_ROW_3	:	GPIO_SET_OUTPUT(KEYPAD_ROW_3_PORT_INDEX,KEYPAD_ROW_3_PIN_INDEX);
+								GPIO_WRITE(KEYPAD_ROW_3_PORT_INDEX,KEYPAD_ROW_3_PIN_INDEX,KEYPAD_PRESSED);
+								break;
+
+		case KEYPAD_ROW_4	:	GPIO_SET_OUTPUT(KEYPAD_ROW_4_PORT_INDEX,KEYPAD_ROW_4_PIN_INDEX);
+								GPIO_WRITE(KEYPAD_ROW_4_PORT_INDEX,KEYPAD_ROW_4_PIN_INDEX,KEYPAD_PRESSED);
+								break;
+
+		default	:			/* Nothing */
+								break;
+	}
+#else
+	/* the keypad pins are selected at run time so they are driven through the GPIO APIs */
+	KEYPAD_ROW(keypad_obj,row).mode = GPIO_MODE_OUTPUT;
+	GPIO_setupPinDirection( &KEYPAD_ROW(keypad_obj,row) );
+
+	/* Set/Clear the row output pin */
+	GPIO_writePin( &KEYPAD_ROW(keypad_obj,row) , KEYPAD_PRESSED );
+#endif
+}
+
+
+/**
+ * @brief  set the row pin again to be input without internal pull up resistance
+ * @param  (keypad_obj) 	pointer to the keypad object passed by reference
+ * @param  (row)			holds the index of the row >> @ref : keypad rows/columns index
+ */
+static void KEYPAD_deactivateRow(keypad_config_t *keypad_obj,uint8 row)
+{
+#if KEYPAD_CONFIG_STATIC_PINS
+	/* the keypad object isn't used as the pins are fixed at compile time */
+	(void)keypad_obj;
+
+	/* the keypad pins are fixed at compile time so they are driven through the GPIO fast path */
+	switch(row)
+	{
+		case KEYPAD_ROW_1	:	GPIO_SET_INPUT(KEYPAD_ROW_1_PORT_INDEX,KEYPAD_ROW_1_PIN_INDEX);
+								GPIO_CLEAR(KEYPAD_ROW_1_PORT_INDEX,KEYPAD_ROW_1_PIN_INDEX);
+								break;
+
+		case KEYPAD_ROW_2	:	GPIO_SET_INPUT(KEYPAD_ROW_2_PORT_INDEX,KEYPAD_ROW_2_PIN_INDEX);
+								GPIO_CLEAR(KEYPAD_ROW_2_PORT_INDEX,KEYPAD_ROW_2_PIN_INDEX);
+								break;
+
+		case KEYPAD_ROW_3	:	GPIO_SET_INPUT(KEYPAD_ROW_3_PORT_INDEX,KEYPAD_ROW_3_PIN_INDEX);
+								GPIO_CLEAR(KEYPAD_ROW_3_PORT_INDEX,KEYPAD_ROW_3_PIN_INDEX);
+								break;
+
+		case KEYPAD_ROW_4	:	GPIO_SET_INPUT(KEYPAD_ROW_4_PORT_INDEX,KEYPAD_ROW_4_PIN_INDEX);
+								GPIO_CLEAR(KEYPAD_ROW_4_PORT_INDEX,KEYPAD_ROW_4_PIN_INDEX);
+								break;
+
+		default	:			/* Nothing */
+								break;
+	}
+#else
+	/* the keypad pins are selected at run time so they are driven through the GPIO APIs */
+	KEYPAD_ROW(keypad_obj,row).mode = GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES;
+	GPIO_setupPinDirection( &KEYPAD_ROW(keypad_obj,row) );
+#endif
+}
+
+
+/**
+ * @brief  read the logic of the column pin
+ * @param  (keypad_obj) 	pointer to the keypad object passed by reference
+ * @param  (column)			holds the index of the column >> @ref : keypad rows/columns index
+ * @return (logic)    		the logic status of the column pin >> @ref : KEYPAD_PRESSED / KEYPAD_RELEASED
+ */
+static uint8 KEYPAD_readColumn(keypad_config_t *keypad_obj,uint8 column)
+{
+	/* create a local variable to hold the logic of the column pin */
+	uint8 logic = KEYPAD_RELEASED;
+
+#if KEYPAD_CONFIG_STATIC_PINS
+	/* the keypad object isn't used as the pins are fixed at compile time */
+	(void)keypad_obj;
+
+	/* the keypad pins are fixed at compile time so they are read through the GPIO fast path */
+	switch(column)
+	{
+		case KEYPAD_COLUMN_1	:	logic = GPIO_READ(KEYPAD_COLUMN_1_PORT_INDEX,KEYPAD_COLUMN_1_PIN_INDEX);
+									break;
+
+		case KEYPAD_COLUMN_2	:	logic = GPIO_READ(KEYPAD_COLUMN_2_PORT_INDEX,KEYPAD_COLUMN_2_PIN_INDEX);
+									break;
+
+		case KEYPAD_COLUMN_3	:	logic = GPIO_READ(KEYPAD_COLUMN_3_PORT_INDEX,KEYPAD_COLUMN_3_PIN_INDEX);
+									break;
+
+		#if KEYPAD_CONFIG_4X4_MODE
+		case KEYPAD_COLUMN_4	:	logic = GPIO_READ(KEYPAD_COLUMN_4_PORT_INDEX,KEYPAD_COLUMN_4_PIN_INDEX);
+									break;
+		#endif
+
+		default	:				/* Nothing */
+									break;
+	}
+#else
+	/* the keypad pins are selected at run time so they are read through the GPIO APIs */
+	logic = GPIO_readPin( &KEYPAD_COLUMN(keypad_obj,column) );
+#endif
+
+	return logic;
+}
+
+
 /* ----------------------------------------------------------------------------------- */
@@ -74,6 +74,50 @@
 #define KEYPAD_RELEASED				GPIO_LOW
 #endif
 
+/* --------------------------------- */
+/* keypad columns pin group configurations enable/disable */
+/* NOTE: if enabled the columns are described by a gpio bus (gpio_bus_t) and KEYPAD_init must be called once
+ *       before KEYPAD_getPressedKey, all the columns are read in one step per port to skip the rows with no pressed button */
+/* NOTE: the rows stay a pins table as they are driven one at a time */
+/* NOTE: it can't be enabled with the keypad static pins configurations */
+
+#define KEYPAD_CONFIG_PIN_GROUPS	DISABLE
+
+/* --------------------------------- */
+/* keypad static pins configurations enable/disable */
+/* NOTE: if enabled the keypad pins are fixed at compile time by the indexes below and the keypad scan uses the GPIO fast path */
+/* NOTE: the pins in the keypad object passed to the keypad APIs must match these indexes */
+
+#define KEYPAD_CONFIG_STATIC_PINS	DISABLE
+
+#if KEYPAD_CONFIG_STATIC_PINS
+/* --Rows-- */
+#define KEYPAD_ROW_1_PORT_INDEX		GPIO_PORTC
+#define KEYPAD_ROW_1_PIN_INDEX		GPIO_PIN0
+#define KEYPAD_ROW_2_PORT_INDEX		GPIO_PORTC
+#define KEYPAD_ROW_2_PIN_INDEX		GPIO_PIN1
+#define KEYPAD_ROW_3_PORT_INDEX		GPIO_PORTC
+#define KEYPAD_ROW_3_PIN_INDEX		GPIO_PIN2
+#define KEYPAD_ROW_4_PORT_INDEX		GPIO_PORTC
+#define KEYPAD_ROW_4_PIN_INDEX		GPIO_PIN3
+
+/* --Columns-- */
+#define KEYPAD_COLUMN_1_PORT_INDEX	GPIO_PORTC
+#define KEYPAD_COLUMN_1_PIN_INDEX	GPIO_PIN4
+#define KEYPAD_COLUMN_2_PORT_INDEX	GPIO_PORTC
+#define KEYPAD_COLUMN_2_PIN_INDEX	GPIO_PIN5
+#define KEYPAD_COLUMN_3_PORT_INDEX	GPIO_PORTC
+#define KEYPAD_COLUMN_3_PIN_INDEX	GPIO_PIN6
+#if KEYPAD_CONFIG_4X4_MODE
+#define KEYPAD_COLUMN_4_PORT_INDEX	GPIO_PORTC
+#define KEYPAD_COLUMN_4_PIN_INDEX	GPIO_PIN7
+#endif
+#endif
+
+#if KEYPAD_CONFIG_PIN_GROUPS && KEYPAD_CONFIG_STATIC_PINS
+#error "KEYPAD_CONFIG_PIN_GROUPS and KEYPAD_CONFIG_STATIC_PINS can't be enabled at the same time"
+#endif
+
 /* --------------------------------- */
 /* Keypad idle (normal) return when no button is pressed in the Keypad */
 
@@ -103,15 +147,41 @@
 typedef struct{
 	/* hold the information of the row pins >> @ref : gpio.h */
 	gpio_config_t rows[KEYPAD_ROW_MAX_SIZE];
+#if KEYPAD_CONFIG_PIN_GROUPS
+	/* hold the information of the column pins (columns.pins[KEYPAD_COLUMN_x]) >> @ref : gpio_bus_t */
+	gpio_bus_t columns;
+#else
 	/* hold the information of the column pins >> @ref : gpio.h */
 	gpio_config_t columns[KEYPAD_COLUMN_MAX_SIZE];
+#endif
 }keypad_config_t;
 
 
+/* ----------------------------------------------------------------------------------- */
+/* -------------------Global section-------------------- */
+
+/* value of every button of the keypad (keypad_pattern[row][column]) , selected by the keypad configurations above */
+extern const uint8 keypad_pattern[KEYPAD_ROW_MAX_SIZE][KEYPAD_COLUMN_MAX_SIZE];
+
+
 /* ----------------------------------------------------------------------------------- */
 /* ------------functions declaration section------------ */
 
 
+#if KEYPAD_CONFIG_PIN_GROUPS
+/**
+ * @brief  initialize the keypad columns pin group :
+ * 				1- Setup the size of the columns group
+ * 				2- Initialize the columns group through the GPIO Driver
+ * @param  (keypad_obj) 	pointer to the keypad object passed by reference
+ * @return (l_status) 		status of the performed operation
+ *              (E_NOT_OK)  	operation failed
+ *              (E_OK)      	operation success
+ */
+Std_ReturnType KEYPAD_init(keypad_config_t *keypad_obj);
+#endif
+
+
 /**
  * @brief  get the value of the pressed button in the keypad
  * @param  (keypad_obj) 	pointer to the keypad object passed by reference
@@ -0,0 +1,194 @@
+/*
+ =========================================================================================
+ Name        : keypad.hpp
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : KEYPAD C++ Template Driver Header file (header only, C++11)
+ =========================================================================================
+*/
+
+#ifndef _KEYPAD_HPP_
+#define _KEYPAD_HPP_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+extern "C" {
+#include "keypad.h"					/* the keypad configurations and keypad_pattern */
+#include "util/delay.h"				/* To use the delay functions */
+}
+#include "gpio.hpp"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * KEYPAD C++ Template Driver :
+ * 	- the rows and the columns are template parameters (gpio::PinGroup) so the scan of the rows is unrolled at compile
+ * 	  time, every row is driven through the GPIO fast path and all the columns are read in one step per port
+ * 	- ROWS : gpio::OutputPin of every row (the row is output only while it's scanned)
+ * 	- COLUMNS : gpio::InputPin of every column (with the internal pull up resistance in the pull-up connection)
+ * 	- the buttons values are keypad_pattern of keypad.c (KEYPAD_CONFIG_xxx of keypad.h) so keypad.c is linked
+ *
+ * 		typedef gpio::PinGroup< gpio::OutputPin<GPIO_PORTC,GPIO_PIN0> , gpio::OutputPin<GPIO_PORTC,GPIO_PIN1> ,
+ * 								gpio::OutputPin<GPIO_PORTC,GPIO_PIN2> , gpio::OutputPin<GPIO_PORTC,GPIO_PIN3> > Rows;
+ * 		typedef gpio::PinGroup< gpio::InputPin<GPIO_PORTC,GPIO_PIN4,true> , gpio::InputPin<GPIO_PORTC,GPIO_PIN5,true> ,
+ * 								gpio::InputPin<GPIO_PORTC,GPIO_PIN6,true> , gpio::InputPin<GPIO_PORTC,GPIO_PIN7,true> > Columns;
+ *
+ * 		keypad::Keypad<Rows , Columns>::init();
+ * 		key = keypad::Keypad<Rows , Columns>::getPressedKey();
+ */
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -----user_defined data type declaration section------ */
+
+namespace keypad
+{
+
+/* --------------------------------- */
+/* compile-time helpers of Keypad */
+
+namespace detail
+{
+
+/* set the row (ROW) to be output and drive it with the pressed logic */
+template <class ROW>
+inline void activateRow(void)
+{
+	GPIO_SET_OUTPUT(ROW::port , ROW::pin);
+	GPIO_WRITE(ROW::port , ROW::pin , KEYPAD_PRESSED);
+}
+
+/* set the row (ROW) again to be input without internal pull up resistance */
+template <class ROW>
+inline void deactivateRow(void)
+{
+	GPIO_SET_INPUT(ROW::port , ROW::pin);
+	GPIO_CLEAR(ROW::port , ROW::pin);
+}
+
+/* deactivate the rows (INDEX) to the last row */
+template <class ROWS , uint8 INDEX , bool END = (INDEX >= ROWS::size)>
+struct DeactivateRows
+{
+	static void deactivate(void)
+	{
+		deactivateRow< typename ROWS::template pin<INDEX> >();
+		DeactivateRows<ROWS , INDEX + 1>::deactivate();
+	}
+};
+
+template <class ROWS , uint8 INDEX>
+struct DeactivateRows<ROWS , INDEX , true>
+{
+	static void deactivate(void) { }
+};
+
+/* scan the rows (INDEX) to the last row, return the value of the pressed button or KEYPAD_IDLE_RETURN */
+template <class ROWS , class COLUMNS , uint8 INDEX , bool END = (INDEX >= ROWS::size)>
+struct ScanRows
+{
+	/* logic of the columns group when no button is pressed */
+	static const uint8 idle = (KEYPAD_RELEASED == GPIO_HIGH) ? (uint8)( (1 << COLUMNS::size) - 1 ) : 0x00;
+
+	/* the column of the group value is pressed */
+	static bool isPressed(uint8 columns , uint8 column)
+	{
+		return ( (columns >> column) & 0x01 ) == KEYPAD_PRESSED;
+	}
+
+	static uint8 scan(void)
+	{
+		typedef typename ROWS::template pin<INDEX> Row;
+
+		/* create a local variable to hold the logic of all the columns */
+		uint8 l_columns = ZERO_INIT;
+		/* create a local variable to traverse the columns */
+		uint8 l_column = ZERO_INIT;
+		/* create a local variable to hold the value of the pressed button */
+		uint8 l_key = KEYPAD_IDLE_RETURN;
+
+		activateRow<Row>();
+		l_columns = COLUMNS::read();
+
+		/* check the columns one by one only if a button is pressed in this row */
+		if(l_columns != idle)
+		{
+			for(l_column = 0; l_column < COLUMNS::size; l_column++)
+			{
+				if( isPressed(l_columns , l_column) )
+				{
+					/* keypad button is pressed */
+					/* wait for 30ms for button de-bounce and check if the button is still pressed */
+					_delay_ms(30);
+
+					if( isPressed(COLUMNS::read() , l_column) )
+					{
+						l_key = keypad_pattern[INDEX][l_column];
+					}
+					else{ /* Nothing */ }
+
+					/* single pressing */
+					while( isPressed(COLUMNS::read() , l_column) );
+
+					break;
+				}
+				else{ /* Nothing */ }
+			}
+		}
+		else{ /* Nothing */ }
+
+		deactivateRow<Row>();
+
+		if(KEYPAD_IDLE_RETURN == l_key)
+		{
+			/* Add small delay to fix CPU load issue in proteus */
+			_delay_ms(5);
+
+			l_key = ScanRows<ROWS , COLUMNS , INDEX + 1>::scan();
+		}
+		else{ /* Nothing */ }
+
+		return l_key;
+	}
+};
+
+template <class ROWS , class COLUMNS , uint8 INDEX>
+struct ScanRows<ROWS , COLUMNS , INDEX , true>
+{
+	static uint8 scan(void) { return KEYPAD_IDLE_RETURN; }
+};
+
+} /* namespace detail */
+
+/* --------------------------------- */
+/* keypad */
+
+template <class ROWS , class COLUMNS>
+struct Keypad
+{
+	static_assert(ROWS::size == KEYPAD_ROW_MAX_SIZE , "the number of rows doesn't match KEYPAD_ROW_MAX_SIZE");
+	static_assert(COLUMNS::size == KEYPAD_COLUMN_MAX_SIZE , "the number of columns doesn't match KEYPAD_COLUMN_MAX_SIZE");
+
+	/* set all the rows to be input (not scanned) and the columns to be input */
+	static void init(void)
+	{
+		detail::DeactivateRows<ROWS , 0>::deactivate();
+		COLUMNS::init();
+	}
+
+	/* get the value of the pressed button in the keypad (KEYPAD_IDLE_RETURN when no button is pressed) */
+	static uint8 getPressedKey(void)
+	{
+		return detail::ScanRows<ROWS , COLUMNS , 0>::scan();
+	}
+};
+
+} /* namespace keypad */
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _KEYPAD_HPP_ */
@@ -19,6 +19,48 @@
 #include "common_macros.h"
 
 
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/* number of the LCD control pins (RS, E and RW if it's used) in the pins table of LCD_init */
+#if LCD_CONFIG_READ_WRITE_PIN
+#define LCD_CONTROL_PINS_SIZE						3
+#else
+#define LCD_CONTROL_PINS_SIZE						2
+#endif
+
+/* number of the pins in the pins table of LCD_init (the data bus pins of a gpio bus are set up by GPIO_busInit) */
+#if LCD_CONFIG_DATA_BUS_GROUP
+#define LCD_INIT_PINS_SIZE							LCD_CONTROL_PINS_SIZE
+#else
+#define LCD_INIT_PINS_SIZE							( LCD_CONTROL_PINS_SIZE + LCD_DATA_BUS_SIZE )
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+/* --------------------------------- */
+/* LCD pins write */
+/* NOTE: (INDEX) of the data bus is the line number 1..8 >> @ref : index of the data bus lines in the LCD */
+
+#if LCD_CONFIG_STATIC_PINS
+/* the LCD pins are fixed at compile time so they are written through the GPIO fast path */
+#define LCD_WRITE_RS(LCD_OBJ,LOGIC)					GPIO_WRITE(LCD_RS_PORT_INDEX,LCD_RS_PIN_INDEX,LOGIC)
+#define LCD_WRITE_E(LCD_OBJ,LOGIC)					GPIO_WRITE(LCD_E_PORT_INDEX,LCD_E_PIN_INDEX,LOGIC)
+#define LCD_WRITE_RW(LCD_OBJ,LOGIC)					GPIO_WRITE(LCD_RW_PORT_INDEX,LCD_RW_PIN_INDEX,LOGIC)
+#define LCD_WRITE_DATA_BUS(LCD_OBJ,INDEX,LOGIC)		GPIO_WRITE(LCD_DATA_BUS_##INDEX##_PORT_INDEX,LCD_DATA_BUS_##INDEX##_PIN_INDEX,LOGIC)
+#else
+/* the LCD pins are selected at run time so they are written through the GPIO APIs */
+#define LCD_WRITE_RS(LCD_OBJ,LOGIC)					GPIO_writePin( &((LCD_OBJ)->register_select) , (LOGIC) )
+#define LCD_WRITE_E(LCD_OBJ,LOGIC)					GPIO_writePin( &((LCD_OBJ)->enable) , (LOGIC) )
+#define LCD_WRITE_RW(LCD_OBJ,LOGIC)					GPIO_writePin( &((LCD_OBJ)->read_write) , (LOGIC) )
+#define LCD_WRITE_DATA_BUS(LCD_OBJ,INDEX,LOGIC)		GPIO_writePin( &((LCD_OBJ)->data_bus[LCD_DATA_BUS_##INDEX]) , (LOGIC) )
+#endif
+
+/* --------------------------------- */
+
+
 /* ----------------------------------------------------------------------------------- */
 /* ------------functions definition section------------- */
 
@@ -36,6 +78,12 @@ Std_ReturnType LCD_init(lcd_config_t *lcd_obj)
 {
 	/* create a local variable to hold the status of the performed operation */
 	Std_ReturnType l_status = ZERO_INIT;
+	/* create a local table to hold the LCD pins set up in one step */
+	gpio_config_t l_pins[LCD_INIT_PINS_SIZE];
+	#if !LCD_CONFIG_DATA_BUS_GROUP
+	/* create a local variable to traverse the data bus pins */
+	uint8 l_index = ZERO_INIT;
+	#endif
 
 	/* check if the address is valid or not */
 	if(lcd_obj == NULL_PTR)
@@ -48,57 +96,62 @@ Std_ReturnType LCD_init(lcd_config_t *lcd_obj)
 	{
 		/* the address passed is valid */
 
-		l_status = E_OK;		/* operation success */
-
 		/* initialize the LCD */
 
-		/* Configure the direction for RS and E pins as output pins */
-		GPIO_setupPinDirection( &(lcd_obj->register_select) );
-		GPIO_setupPinDirection( &(lcd_obj->enable) );
-		/* Configure the direction for Read/Write pin as output pin if needed */
+		/* --------------------------------- */
+		/* Configure the direction for RS, E (and Read/Write if needed) pins and the data bus pins as output pins
+		   from one table so every DDR/PORT Register is written once */
+		l_pins[0] = lcd_obj->register_select;
+		l_pins[1] = lcd_obj->enable;
 		#if LCD_CONFIG_READ_WRITE_PIN
-		GPIO_setupPinDirection( &(lcd_obj->read_write) );
+		l_pins[2] = lcd_obj->read_write;
 		#endif
-
-		_delay_ms(20);			/* LCD Power ON delay always > 15ms */
-
-		/* 4-bit mode */
-		#if LCD_CONFIG_4_BIT_MODE
-		/* set the 4 pins of the data bus to be output */
-		GPIO_setupPinDirection( &(lcd_obj->data_bus[LCD_DATA_BUS_1]) );
-		GPIO_setupPinDirection( &(lcd_obj->data_bus[LCD_DATA_BUS_2]) );
-		GPIO_setupPinDirection( &(lcd_obj->data_bus[LCD_DATA_BUS_3]) );
-		GPIO_setupPinDirection( &(lcd_obj->data_bus[LCD_DATA_BUS_4]) );
-
-		/* LCD 4 bit Mode Initialization */
-		LCD_sendCommand(lcd_obj,LCD_TWO_LINES_FOUR_BITS_MODE_INIT1);
-		LCD_sendCommand(lcd_obj,LCD_TWO_LINES_FOUR_BITS_MODE_INIT2);
-
-		/* LCD 4-bit mode, 2 row mode, 5x8 dot matrix */
-		LCD_sendCommand(lcd_obj,LCD_4_bit_2_row_5x8);
+		#if !LCD_CONFIG_DATA_BUS_GROUP
+		for(l_index = 0; l_index < LCD_DATA_BUS_SIZE; l_index++)
+		{
+			l_pins[LCD_CONTROL_PINS_SIZE + l_index] = lcd_obj->data_bus[l_index];
+		}
 		#endif
+		l_status = GPIO_setupPinsFromTable( l_pins , LCD_INIT_PINS_SIZE );
 
-		/* 8-bit mode */
-		#if LCD_CONFIG_8_BIT_MODE
-		/* set the 8 pins of the data bus to be output */
-		GPIO_setupPinDirection( &(lcd_obj->data_bus[LCD_DATA_BUS_1]) );
-		GPIO_setupPinDirection( &(lcd_obj->data_bus[LCD_DATA_BUS_2]) );
-		GPIO_setupPinDirection( &(lcd_obj->data_bus[LCD_DATA_BUS_3]) );
-		GPIO_setupPinDirection( &(lcd_obj->data_bus[LCD_DATA_BUS_4]) );
-		GPIO_setupPinDirection( &(lcd_obj->data_bus[LCD_DATA_BUS_5]) );
-		GPIO_setupPinDirection( &(lcd_obj->data_bus[LCD_DATA_BUS_6]) );
-		GPIO_setupPinDirection( &(lcd_obj->data_bus[LCD_DATA_BUS_7]) );
-		GPIO_setupPinDirection( &(lcd_obj->data_bus[LCD_DATA_BUS_8]) );
-
-		/* LCD 8-bit mode, 2 row mode, 5x8 dot matrix */
-		LCD_sendCommand(lcd_obj,LCD_8_bit_2_row_5x8);
+		/* the data bus pins of a gpio bus are set up with its bit-scatter plan */
+		#if LCD_CONFIG_DATA_BUS_GROUP
+		if(E_OK == l_status)
+		{
+			lcd_obj->data_bus.size = LCD_DATA_BUS_SIZE;
+			l_status = GPIO_busInit( &(lcd_obj->data_bus) );
+		}
+		else{ /* Nothing */ }
 		#endif
+		/* --------------------------------- */
 
-		/* display on underline cursor off blink off */
-		LCD_sendCommand(lcd_obj,LCD_DISPLAY_ON_UNDERLINE_OFF_BLINK_OFF);
+		if(E_OK == l_status)
+		{
+			_delay_ms(20);			/* LCD Power ON delay always > 15ms */
 
-		/* clear display */
-		LCD_sendCommand(lcd_obj,LCD_CLEAR_DISPLAY);
+			/* 4-bit mode */
+			#if LCD_CONFIG_4_BIT_MODE
+			/* LCD 4 bit Mode Initialization */
+			LCD_sendCommand(lcd_obj,LCD_TWO_LINES_FOUR_BITS_MODE_INIT1);
+			LCD_sendCommand(lcd_obj,LCD_TWO_LINES_FOUR_BITS_MODE_INIT2);
+
+			/* LCD 4-bit mode, 2 row mode, 5x8 dot matrix */
+			LCD_sendCommand(lcd_obj,LCD_4_bit_2_row_5x8);
+			#endif
+
+			/* 8-bit mode */
+			#if LCD_CONFIG_8_BIT_MODE
+			/* LCD 8-bit mode, 2 row mode, 5x8 dot matrix */
+			LCD_sendCommand(lcd_obj,LCD_8_bit_2_row_5x8);
+			#endif
+
+			/* display on underline cursor off blink off */
+			LCD_sendCommand(lcd_obj,LCD_DISPLAY_ON_UNDERLINE_OFF_BLINK_OFF);
+
+			/* clear display */
+			LCD_sendCommand(lcd_obj,LCD_CLEAR_DISPLAY);
+		}
+		else{ /* Nothing */ }
 	}
 
 	return l_status;
@@ -134,50 +187,58 @@ Std_ReturnType LCD_sendCommand(lcd_config_t *lcd_obj,uint8 command)
 		/* send the command to the LCD */
 
 		/* Instruction Mode RS=0 */
-		GPIO_writePin( &(lcd_obj->register_select) , LCD_SELECT_COMMAND );
+		LCD_WRITE_RS( lcd_obj , LCD_SELECT_COMMAND );
 
 		_delay_ms(1); 			/* delay for processing Tas = 50ns */
 
 		/* Enable LCD E=1 */
-		GPIO_writePin( &(lcd_obj->enable) , GPIO_HIGH );
+		LCD_WRITE_E( lcd_obj , GPIO_HIGH );
 
 		_delay_ms(1); 			/* delay for processing Tpw - Tdws = 190ns */
 
 		/* select the write mode */
 		#if LCD_CONFIG_READ_WRITE_PIN
-		GPIO_writePin( &(lcd_obj->read_write) , LCD_WRITE );
+		LCD_WRITE_RW( lcd_obj , LCD_WRITE );
 		#endif
 
 		/* 4-bit mode */
 		#if LCD_CONFIG_4_BIT_MODE
 		/* send the highest 4 bits in command through the data bus */
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_1]) , GET_BIT(command,4) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_2]) , GET_BIT(command,5) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_3]) , GET_BIT(command,6) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_4]) , GET_BIT(command,7) );
+		#if LCD_CONFIG_DATA_BUS_GROUP
+		GPIO_busWrite( &(lcd_obj->data_bus) , (command >> 4) );
+		#else
+		LCD_WRITE_DATA_BUS( lcd_obj , 1 , GET_BIT(command,4) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 2 , GET_BIT(command,5) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 3 , GET_BIT(command,6) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 4 , GET_BIT(command,7) );
+		#endif
 
 		_delay_ms(1); 			/* delay for processing Tdsw = 100ns */
 
 		/* Disable LCD E=0 */
-		GPIO_writePin( &(lcd_obj->enable) , GPIO_LOW );
+		LCD_WRITE_E( lcd_obj , GPIO_LOW );
 
 		_delay_ms(1); 			/* delay for processing Th = 13ns */
 
 		/* Enable LCD E=1 */
-		GPIO_writePin( &(lcd_obj->enable) , GPIO_HIGH );
+		LCD_WRITE_E( lcd_obj , GPIO_HIGH );
 
 		_delay_ms(1); 			/* delay for processing Tpw - Tdws = 190ns */
 
 		/* send the lowest 4 bits in command through the data bus */
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_1]) , GET_BIT(command,0) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_2]) , GET_BIT(command,1) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_3]) , GET_BIT(command,2) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_4]) , GET_BIT(command,3) );
+		#if LCD_CONFIG_DATA_BUS_GROUP
+		GPIO_busWrite( &(lcd_obj->data_bus) , (command & 0x0F) );
+		#else
+		LCD_WRITE_DATA_BUS( lcd_obj , 1 , GET_BIT(command,0) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 2 , GET_BIT(command,1) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 3 , GET_BIT(command,2) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 4 , GET_BIT(command,3) );
+		#endif
 
 		_delay_ms(1); 			/* delay for processing Tdsw = 100ns */
 
 		/* Disable LCD E=0 */
-		GPIO_writePin( &(lcd_obj->enable) , GPIO_LOW );
+		LCD_WRITE_E( lcd_obj , GPIO_LOW );
 
 		_delay_ms(1); 			/* delay for processing Th = 13ns */
 		#endif
@@ -185,19 +246,23 @@ Std_ReturnType LCD_sendCommand(lcd_config_t *lcd_obj,uint8 command)
 		/* 8-bit mode */
 		#if LCD_CONFIG_8_BIT_MODE
 		/* send the command through the data bus */
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_1]) , GET_BIT(command,0) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_2]) , GET_BIT(command,1) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_3]) , GET_BIT(command,2) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_4]) , GET_BIT(command,3) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_5]) , GET_BIT(command,4) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_6]) , GET_BIT(command,5) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_7]) , GET_BIT(command,6) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_8]) , GET_BIT(command,7) );
+		#if LCD_CONFIG_DATA_BUS_GROUP
+		GPIO_busWrite( &(lcd_obj->data_bus) , command );
+		#else
+		LCD_WRITE_DATA_BUS( lcd_obj , 1 , GET_BIT(command,0) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 2 , GET_BIT(command,1) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 3 , GET_BIT(command,2) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 4 , GET_BIT(command,3) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 5 , GET_BIT(command,4) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 6 , GET_BIT(command,5) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 7 , GET_BIT(command,6) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 8 , GET_BIT(command,7) );
+		#endif
 
 		_delay_ms(1); 			/* delay for processing Tdsw = 100ns */
 
 		/* Disable LCD E=0 */
-		GPIO_writePin( &(lcd_obj->enable) , GPIO_LOW );
+		LCD_WRITE_E( lcd_obj , GPIO_LOW );
 
 		_delay_ms(1); 			/* delay for processing Th = 13ns */
 		#endif
@@ -236,50 +301,58 @@ Std_ReturnType LCD_displayCharacter(lcd_config_t *lcd_obj,uint8 data)
 		/* send the data to the LCD */
 
 		/* Instruction Mode RS=1 */
-		GPIO_writePin( &(lcd_obj->register_select) , LCD_SELECT_DATA );
+		LCD_WRITE_RS( lcd_obj , LCD_SELECT_DATA );
 
 		_delay_ms(1); 			/* delay for processing Tas = 50ns */
 
 		/* Enable LCD E=1 */
-		GPIO_writePin( &(lcd_obj->enable) , GPIO_HIGH );
+		LCD_WRITE_E( lcd_obj , GPIO_HIGH );
 
 		_delay_ms(1); 			/* delay for processing Tpw - Tdws = 190ns */
 
 		/* select the write mode */
 		#if LCD_CONFIG_READ_WRITE_PIN
-		GPIO_writePin( &(lcd_obj->read_write) , LCD_WRITE );
+		LCD_WRITE_RW( lcd_obj , LCD_WRITE );
 		#endif
 
 		/* 4-bit mode */
 		#if LCD_CONFIG_4_BIT_MODE
 		/* send the highest 4 bits in data through the data bus */
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_1]) , GET_BIT(data,4) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_2]) , GET_BIT(data,5) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_3]) , GET_BIT(data,6) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_4]) , GET_BIT(data,7) );
+		#if LCD_CONFIG_DATA_BUS_GROUP
+		GPIO_busWrite( &(lcd_obj->data_bus) , (data >> 4) );
+		#else
+		LCD_WRITE_DATA_BUS( lcd_obj , 1 , GET_BIT(data,4) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 2 , GET_BIT(data,5) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 3 , GET_BIT(data,6) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 4 , GET_BIT(data,7) );
+		#endif
 
 		_delay_ms(1); 			/* delay for processing Tdsw = 100ns */
 
 		/* Disable LCD E=0 */
-		GPIO_writePin( &(lcd_obj->enable) , GPIO_LOW );
+		LCD_WRITE_E( lcd_obj , GPIO_LOW );
 
 		_delay_ms(1); 			/* delay for processing Th = 13ns */
 
 		/* Enable LCD E=1 */
-		GPIO_writePin( &(lcd_obj->enable) , GPIO_HIGH );
+		LCD_WRITE_E( lcd_obj , GPIO_HIGH );
 
 		_delay_ms(1); 			/* delay for processing Tpw - Tdws = 190ns */
 
 		/* send the lowest 4 bits in data through the data bus */
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_1]) , GET_BIT(data,0) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_2]) , GET_BIT(data,1) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_3]) , GET_BIT(data,2) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_4]) , GET_BIT(data,3) );
+		#if LCD_CONFIG_DATA_BUS_GROUP
+		GPIO_busWrite( &(lcd_obj->data_bus) , (data & 0x0F) );
+		#else
+		LCD_WRITE_DATA_BUS( lcd_obj , 1 , GET_BIT(data,0) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 2 , GET_BIT(data,1) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 3 , GET_BIT(data,2) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 4 , GET_BIT(data,3) );
+		#endif
 
 		_delay_ms(1); 			/* delay for processing Tdsw = 100ns */
 
 		/* Disable LCD E=0 */
-		GPIO_writePin( &(lcd_obj->enable) , GPIO_LOW );
+		LCD_WRITE_E( lcd_obj , GPIO_LOW );
 
 		_delay_ms(1); 			/* delay for processing Th = 13ns */
 		#endif
@@ -287,19 +360,23 @@ Std_ReturnType LCD_displayCharacter(lcd_config_t *lcd_obj,uint8 data)
 		/* 8-bit mode */
 		#if LCD_CONFIG_8_BIT_MODE
 		/* send the data through the data bus */
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_1]) , GET_BIT(data,0) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_2]) , GET_BIT(data,1) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_3]) , GET_BIT(data,2) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_4]) , GET_BIT(data,3) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_5]) , GET_BIT(data,4) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_6]) , GET_BIT(data,5) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_7]) , GET_BIT(data,6) );
-		GPIO_writePin( &(lcd_obj->data_bus[LCD_DATA_BUS_8]) , GET_BIT(data,7) );
+		#if LCD_CONFIG_DATA_BUS_GROUP
+		GPIO_busWrite( &(lcd_obj->data_bus) , data );
+		#else
+		LCD_WRITE_DATA_BUS( lcd_obj , 1 , GET_BIT(data,0) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 2 , GET_BIT(data,1) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 3 , GET_BIT(data,2) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 4 , GET_BIT(data,3) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 5 , GET_BIT(data,4) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 6 , GET_BIT(data,5) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 7 , GET_BIT(data,6) );
+		LCD_WRITE_DATA_BUS( lcd_obj , 8 , GET_BIT(data,7) );
+		#endif
 
 		_delay_ms(1); 			/* delay for processing Tdsw = 100ns */
 
 		/* Disable LCD E=0 */
-		GPIO_writePin( &(lcd_obj->enable) , GPIO_LOW );
+		LCD_WRITE_E( lcd_obj , GPIO_LOW );
 
 		_delay_ms(1); 			/* delay for processing Th = 13ns */
 		#endif
@@ -47,6 +47,60 @@
 
 #define LCD_CONFIG_READ_WRITE_PIN	DISABLE
 
+/* --------------------------------- */
+/* LCD data bus pin group configurations enable/disable */
+/* NOTE: if enabled the data bus is described by a gpio bus (gpio_bus_t) and every nibble/byte is written in one step per port */
+/* NOTE: it can't be enabled with the LCD static pins configurations */
+
+#define LCD_CONFIG_DATA_BUS_GROUP	DISABLE
+
+/* --------------------------------- */
+/* LCD static pins configurations enable/disable */
+/* NOTE: if enabled the LCD pins are fixed at compile time by the indexes below and the LCD is driven through the GPIO fast path */
+/* NOTE: the pins in the LCD object passed to the LCD APIs must match these indexes */
+
+#define LCD_CONFIG_STATIC_PINS		DISABLE
+
+#if LCD_CONFIG_STATIC_PINS
+/* --RS-- */
+#define LCD_RS_PORT_INDEX			GPIO_PORTB
+#define LCD_RS_PIN_INDEX			GPIO_PIN0
+
+/* --E-- */
+#define LCD_E_PORT_INDEX			GPIO_PORTB
+#define LCD_E_PIN_INDEX				GPIO_PIN1
+
+/* --RW-- */
+#if LCD_CONFIG_READ_WRITE_PIN
+#define LCD_RW_PORT_INDEX			GPIO_PORTB
+#define LCD_RW_PIN_INDEX			GPIO_PIN2
+#endif
+
+/* --Data Bus-- */
+#define LCD_DATA_BUS_1_PORT_INDEX	GPIO_PORTA
+#define LCD_DATA_BUS_1_PIN_INDEX	GPIO_PIN0
+#define LCD_DATA_BUS_2_PORT_INDEX	GPIO_PORTA
+#define LCD_DATA_BUS_2_PIN_INDEX	GPIO_PIN1
+#define LCD_DATA_BUS_3_PORT_INDEX	GPIO_PORTA
+#define LCD_DATA_BUS_3_PIN_INDEX	GPIO_PIN2
+#define LCD_DATA_BUS_4_PORT_INDEX	GPIO_PORTA
+#define LCD_DATA_BUS_4_PIN_INDEX	GPIO_PIN3
+#if LCD_CONFIG_8_BIT_MODE
+#define LCD_DATA_BUS_5_PORT_INDEX	GPIO_PORTA
+#define LCD_DATA_BUS_5_PIN_INDEX	GPIO_PIN4
+#define LCD_DATA_BUS_6_PORT_INDEX	GPIO_PORTA
+#define LCD_DATA_BUS_6_PIN_INDEX	GPIO_PIN5
+#define LCD_DATA_BUS_7_PORT_INDEX	GPIO_PORTA
+#define LCD_DATA_BUS_7_PIN_INDEX	GPIO_PIN6
+#define LCD_DATA_BUS_8_PORT_INDEX	GPIO_PORTA
+#define LCD_DATA_BUS_8_PIN_INDEX	GPIO_PIN7
+#endif
+#endif
+
+#if LCD_CONFIG_DATA_BUS_GROUP && LCD_CONFIG_STATIC_PINS
+#error "LCD_CONFIG_DATA_BUS_GROUP and LCD_CONFIG_STATIC_PINS can't be enabled at the same time"
+#endif
+
 /* --------------------------------- */
 /* character LCD Commands */
 
@@ -153,7 +207,12 @@ typedef struct{
 	/* enable/disable the read/write in the LCD */
 	gpio_config_t enable;
 	/* hold the information of the LCD data bus pins */
+	#if LCD_CONFIG_DATA_BUS_GROUP
+	/* data_bus.pins[LCD_DATA_BUS_x] with data_bus.size = LCD_DATA_BUS_SIZE >> @ref : gpio_bus_t */
+	gpio_bus_t data_bus;
+	#else
 	gpio_config_t data_bus[LCD_DATA_BUS_SIZE];
+	#endif
 	/* selects to whether to read from or write to the LCD >> @ref : lcd_rw_t */
 	#if LCD_CONFIG_READ_WRITE_PIN
 	gpio_config_t read_write;
@@ -0,0 +1,206 @@
+/*
+ =========================================================================================
+ Name        : lcd.hpp
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : LCD C++ Template Driver Header file (header only, C++11)
+ =========================================================================================
+*/
+
+#ifndef _LCD_HPP_
+#define _LCD_HPP_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include <stdlib.h>					/* for itoa C function */
+
+extern "C" {
+#include "lcd.h"					/* the character LCD Commands */
+#include "util/delay.h"				/* To use the delay functions */
+}
+#include "gpio.hpp"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * LCD C++ Template Driver :
+ * 	- the LCD pins are template parameters (gpio::OutputPin / gpio::PinGroup) so every pin access is folded to the GPIO
+ * 	  fast path and the data bus is written with one masked write per used port, no object and no RAM
+ * 	- the data bus mode is the size of the DATA group (4 pins >> 4-bit mode , 8 pins >> 8-bit mode), DATA::pin<0> is
+ * 	  the D0 line in 8-bit mode and the D4 line in 4-bit mode
+ * 	- the Read/Write pin of the LCD is connected to the ground (write only)
+ * 	- the LCD_CONFIG_xxx configurations of lcd.h are used by lcd.c only
+ *
+ * 		typedef lcd::Lcd< gpio::OutputPin<GPIO_PORTB,GPIO_PIN0> , gpio::OutputPin<GPIO_PORTB,GPIO_PIN1> ,
+ * 						  gpio::PinGroup< gpio::OutputPin<GPIO_PORTA,GPIO_PIN4> , gpio::OutputPin<GPIO_PORTA,GPIO_PIN5> ,
+ * 										  gpio::OutputPin<GPIO_PORTA,GPIO_PIN6> , gpio::OutputPin<GPIO_PORTA,GPIO_PIN7> > > Lcd;
+ *
+ * 		Lcd::init();
+ * 		Lcd::displayStringRowColumn(LCD_ROW_1 , 1 , "Hello");
+ */
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -----user_defined data type declaration section------ */
+
+namespace lcd
+{
+
+template <class RS , class E , class DATA>
+struct Lcd
+{
+	static_assert( (DATA::size == 4) || (DATA::size == 8) , "the LCD data bus must have 4 or 8 pins" );
+
+	/* Initialize the LCD : setup the LCD pins as output pins then the data mode 4-bits or 8-bits */
+	static void init(void)
+	{
+		RS::init();
+		E::init();
+		DATA::init();
+
+		_delay_ms(20);			/* LCD Power ON delay always > 15ms */
+
+		if(DATA::size == 4)
+		{
+			/* LCD 4 bit Mode Initialization */
+			sendCommand(LCD_TWO_LINES_FOUR_BITS_MODE_INIT1);
+			sendCommand(LCD_TWO_LINES_FOUR_BITS_MODE_INIT2);
+
+			/* LCD 4-bit mode, 2 row mode, 5x8 dot matrix */
+			sendCommand(LCD_4_bit_2_row_5x8);
+		}
+		else
+		{
+			/* LCD 8-bit mode, 2 row mode, 5x8 dot matrix */
+			sendCommand(LCD_8_bit_2_row_5x8);
+		}
+
+		/* display on underline cursor off blink off */
+		sendCommand(LCD_DISPLAY_ON_UNDERLINE_OFF_BLINK_OFF);
+
+		/* clear display */
+		sendCommand(LCD_CLEAR_DISPLAY);
+	}
+
+	/* send the command to the LCD (Instruction Mode RS=0) */
+	static void sendCommand(uint8 command)
+	{
+		RS::write(LCD_SELECT_COMMAND);
+		send(command);
+	}
+
+	/* send the data to the LCD (Data Mode RS=1) */
+	static void displayCharacter(uint8 data)
+	{
+		RS::write(LCD_SELECT_DATA);
+		send(data);
+	}
+
+	/* Display the required string on the LCD */
+	static void displayString(const char *str)
+	{
+		/* send until NULL Character is encountered */
+		while(*str != '\0')
+		{
+			displayCharacter(*str);
+			str++;
+		}
+	}
+
+	/* Move the cursor to a specified row and column index on the LCD (both start from 1) */
+	static void moveCursor(uint8 row , uint8 column)
+	{
+		/* decrement column as it starts from zero */
+		column--;
+
+		/* the same DDRAM addresses of the rows as LCD_moveCursor */
+		switch(row)
+		{
+			case LCD_ROW_1	:	sendCommand( (LCD_DDRAM_SET_ADDRESS + 0x00) + column );
+								break;
+
+			case LCD_ROW_2	:	sendCommand( (LCD_DDRAM_SET_ADDRESS + 0x40) + column );
+								break;
+
+			case LCD_ROW_3	:	sendCommand( (LCD_DDRAM_SET_ADDRESS + 0x10) + column );
+								break;
+
+			case LCD_ROW_4	:	sendCommand( (LCD_DDRAM_SET_ADDRESS + 0x50) + column );
+								break;
+
+			default	:		/* Nothing */
+								break;
+		}
+	}
+
+	/* Display the required string in a specified row and column index on the LCD */
+	static void displayStringRowColumn(uint8 row , uint8 column , const char *str)
+	{
+		moveCursor(row , column);
+		displayString(str);
+	}
+
+	/* Display the required decimal value on the LCD */
+	static void intgerToString(sint32 data)
+	{
+		/* String to hold the ASCII result */
+		char buffer[16];
+
+		/* Use itoa C function to convert the data to its corresponding ASCII value, 10 for decimal */
+		itoa(data , buffer , 10);
+
+		displayString(buffer);
+	}
+
+	/* Send the clear screen command to the LCD */
+	static void clearScreen(void)
+	{
+		sendCommand(LCD_CLEAR_DISPLAY);
+	}
+
+private:
+	/* latch the command/data on the data bus by the Enable pin (one nibble at a time in 4-bit mode) */
+	static void send(uint8 value)
+	{
+		_delay_ms(1); 			/* delay for processing Tas = 50ns */
+
+		if(DATA::size == 4)
+		{
+			/* send the highest 4 bits then the lowest 4 bits */
+			latch( (uint8)(value >> 4) );
+			latch( (uint8)(value & 0x0F) );
+		}
+		else
+		{
+			latch(value);
+		}
+	}
+
+	/* write the data bus between the rising and the falling edges of the Enable pin */
+	static void latch(uint8 value)
+	{
+		/* Enable LCD E=1 */
+		E::set();
+
+		_delay_ms(1); 			/* delay for processing Tpw - Tdws = 190ns */
+
+		DATA::write(value);
+
+		_delay_ms(1); 			/* delay for processing Tdsw = 100ns */
+
+		/* Disable LCD E=0 */
+		E::clear();
+
+		_delay_ms(1); 			/* delay for processing Th = 13ns */
+	}
+};
+
+} /* namespace lcd */
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _LCD_HPP_ */
@@ -35,8 +35,9 @@ uint8 LM35_getTemperature(void)
 	/* Read ADC channel where the temperature sensor is connected */
 	adc_val = ADC_readChannelBlocking(LM35_SENSOR_CHANNEL_ID);
 
-	/* Calculate the temperature from the ADC value*/
-	temp_val = (uint8)( ( (uint32)adc_val * LM35_SENSOR_MAX_TEMPERATURE * ADC_REF_VOLTAGE_VALUE  )/( LM35_SENSOR_MAX_VOLTAGE * ADC_MAXIMUM_VALUE ) );
+	/* Calculate the temperature from the ADC value (the voltages are in mV so the calculation is integer) */
+	temp_val = (uint8)( ( (uint32)adc_val * ( (uint32)LM35_SENSOR_MAX_TEMPERATURE * ADC_REF_VOLTAGE_MV ) ) /
+						( (uint32)LM35_SENSOR_MAX_VOLTAGE_MV * ADC_MAXIMUM_VALUE ) );
 
 	return temp_val;
 }
@@ -28,8 +28,8 @@
 
 /* --------------------------------- */
 
-/* LM35 Sensor Maximum Voltage */
-#define LM35_SENSOR_MAX_VOLTAGE			1.5
+/* LM35 Sensor Maximum Voltage in mV */
+#define LM35_SENSOR_MAX_VOLTAGE_MV		1500
 
 /* LM35 Sensor Maximum Temperature */
 #define LM35_SENSOR_MAX_TEMPERATURE		150
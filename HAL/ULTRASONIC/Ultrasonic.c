@@ -16,6 +16,18 @@
 #include "util/delay.h"				/* To use the delay functions */
 
 
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+#if ULTRASONIC_CONFIG_STATIC_TRIGGER_PIN
+/* the Trigger pin is fixed at compile time so it is written through the GPIO fast path */
+#define ULTRASONIC_WRITE_TRIGGER(LOGIC)		GPIO_WRITE(ULTRASONIC_TRIGGER_PORT_INDEX,ULTRASONIC_TRIGGER_PIN_INDEX,LOGIC)
+#else
+/* the Trigger pin is selected at run time so it is written through the GPIO APIs */
+#define ULTRASONIC_WRITE_TRIGGER(LOGIC)		GPIO_writePin( &Ultrasonic_TriggerPin , (LOGIC) )
+#endif
+
+
 /* ----------------------------------------------------------------------------------- */
 /* -------------------Global section-------------------- */
 
@@ -32,6 +44,9 @@ gpio_config_t Ultrasonic_TriggerPin;
 /* create a static variable to hold the value of the pre-scaler of TIMER1 */
 static uint16 Ultrasonic_prescaler = 0;
 
+/* create a static variable to hold the number of ticks of TIMER1 in the 10us Trigger pulse */
+static uint16 Ultrasonic_counts_10us = 0;
+
 #endif
 
 
@@ -48,7 +63,7 @@ static uint16 Ultrasonic_prescaler = 0;
  * 				4- Setup the direction of the Trigger pin as Output through the GPIO Driver
  * @param  (ultrasonic_obj)  pointer to the Ultrasonic object passed by reference
  * @return (l_status) 	     status of the performed operation
- *              (E_NOT_OK)  	operation failed
+ *              (E_NOT_OK)  	operation failed (or the clock source of the ICU has no pre-scaler)
  *              (E_OK)      	operation success
  */
 Std_ReturnType Ultrasonic_init(ultrasonic_config_t *ultrasonic_obj)
@@ -79,25 +94,38 @@ Std_ReturnType Ultrasonic_init(ultrasonic_config_t *ultrasonic_obj)
 			case TIMER1_CLOCK_SOURCE_DIV_64		:	Ultrasonic_prescaler = 64;		break;
 			case TIMER1_CLOCK_SOURCE_DIV_256	:	Ultrasonic_prescaler = 256;		break;
 			case TIMER1_CLOCK_SOURCE_DIV_1024	:	Ultrasonic_prescaler = 1024;	break;
-			default		:	/* Nothing */	break;
+			/* no clock or an external clock : the 10us Trigger pulse can't be timed */
+			default		:	l_status = E_NOK;	break;
 		}
 
-		/* Setup the ICU Call Back function */
-		/* Ultrasonic_edgeProcessing is the call back function called by the ICU Driver */
-		ultrasonic_obj->icu_cfg.TIMER1_ICU_DefaultHandler = Ultrasonic_edgeProcessing;
+		if(E_OK == l_status)
+		{
+			/* calculate the number of ticks needed to count 10us (at least one tick for the slow clocks) */
+			Ultrasonic_counts_10us = (uint16)TIMING_US_TO_TICKS(ULTRASONIC_TRIGGER_PULSE_US , Ultrasonic_prescaler);
+			if(Ultrasonic_counts_10us == 0)
+			{
+				Ultrasonic_counts_10us = 1;
+			}
+			else{ /* Nothing */ }
+
+			/* Setup the ICU Call Back function */
+			/* Ultrasonic_edgeProcessing is the call back function called by the ICU Driver */
+			ultrasonic_obj->icu_cfg.TIMER1_ICU_DefaultHandler = Ultrasonic_edgeProcessing;
 
 
-		/* Initialize the ICU Driver */
-		l_status = TIMER1_OVERFLOW_init( &(ultrasonic_obj->icu_cfg) );
+			/* Initialize the ICU Driver */
+			l_status = TIMER1_OVERFLOW_init( &(ultrasonic_obj->icu_cfg) );
 
 
-		/* Setup the Ultrasonic Call Back function */
-		ULTRASONIC_InterruptHandler = ultrasonic_obj->ULTRASONIC_DefaultHandler;
+			/* Setup the Ultrasonic Call Back function */
+			ULTRASONIC_InterruptHandler = ultrasonic_obj->ULTRASONIC_DefaultHandler;
 
 
-		/* Setup the direction of the Trigger pin as Output through the GPIO Driver */
-		l_status = GPIO_setupPinDirection(&Ultrasonic_TriggerPin);
-		GPIO_writePin( &Ultrasonic_TriggerPin , GPIO_LOW );
+			/* Setup the direction of the Trigger pin as Output through the GPIO Driver */
+			l_status = GPIO_setupPinDirection(&Ultrasonic_TriggerPin);
+			GPIO_writePin( &Ultrasonic_TriggerPin , GPIO_LOW );
+		}
+		else{ /* Nothing */ }
 	}
 
 	return l_status;
@@ -109,17 +137,11 @@ Std_ReturnType Ultrasonic_init(ultrasonic_config_t *ultrasonic_obj)
  */
 void Ultrasonic_Trigger(void)
 {
-	/* create a local variable to hold the number of ticks needed to count 10us */
-	uint32 counts_10us;
-
 	/* write logic 1 on the Trigger pin for 10us */
-	GPIO_writePin( &Ultrasonic_TriggerPin , GPIO_HIGH );
-
-	/* calculate the number of ticks needed to count 10us */
-	counts_10us = 10.0 / PERIOD_US(Ultrasonic_prescaler);
+	ULTRASONIC_WRITE_TRIGGER(GPIO_HIGH);
 
-	/* update the Timer/Counter1 Register to start count from it and Over Flow after 10us */
-	TIMER1_setTimerValue( (65536 - counts_10us) );
+	/* update the Timer/Counter1 Register to start count from it and Over Flow after 10us (ticks calculated in Ultrasonic_init) */
+	TIMER1_setTimerValue( (uint16)(65536UL - Ultrasonic_counts_10us) );
 
 	/* wait for Over Flow to happen after 10us */
 	while( !(_TIFR._TOV1) );
@@ -128,7 +150,7 @@ void Ultrasonic_Trigger(void)
 	_TIFR._TOV1 = SET;
 
 	/* write logic 0 on the Trigger pin after 10us pulse */
-	GPIO_writePin( &Ultrasonic_TriggerPin , GPIO_LOW );
+	ULTRASONIC_WRITE_TRIGGER(GPIO_LOW);
 }
 
 
@@ -140,8 +162,9 @@ void Ultrasonic_Trigger(void)
  */
 uint16 Ultrasonic_readDistance(uint16 counts)
 {
-	/* calculate the distance measured by the Ultrasonic in Centimeter */
-	uint16 distance = counts / ( 1000.0 / (17.0 * PERIOD_US(Ultrasonic_prescaler)) );
+	/* calculate the distance measured by the Ultrasonic in Centimeter :
+	 	 distance = echo time (ms) * half of the sound speed (cm/ms) = (counts * prescaler / F_CPU(kHz)) * 17 */
+	uint16 distance = (uint16)( ( (uint32)counts * Ultrasonic_prescaler * ULTRASONIC_HALF_SOUND_SPEED_CM_PER_MS ) / (CPU_FREQUENCY_KHZ) );
 
 	/* wait for 60ms before sending another Trigger Pulse */
 	_delay_ms(60);
@@ -18,6 +18,32 @@
 #include "timer1.h"
 
 
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/* --------------------------------- */
+/* Ultrasonic static Trigger pin configurations enable/disable */
+/* NOTE: if enabled the Trigger pin is fixed at compile time by the indexes below and the Trigger pulse uses the GPIO fast path */
+/* NOTE: Ultrasonic_TriggerPin initialized in the APPLICATION Layer must match these indexes */
+
+#define ULTRASONIC_CONFIG_STATIC_TRIGGER_PIN	DISABLE
+
+#if ULTRASONIC_CONFIG_STATIC_TRIGGER_PIN
+#define ULTRASONIC_TRIGGER_PORT_INDEX			GPIO_PORTB
+#define ULTRASONIC_TRIGGER_PIN_INDEX			GPIO_PIN5
+#endif
+
+/* --------------------------------- */
+
+/* width of the Trigger pulse in us */
+#define ULTRASONIC_TRIGGER_PULSE_US				10
+
+/* half of the sound speed in cm/ms (the echo time is the time to go and return) */
+#define ULTRASONIC_HALF_SOUND_SPEED_CM_PER_MS	17
+
+/* --------------------------------- */
+
+
 /* ----------------------------------------------------------------------------------- */
 /* -----user_defined data type declaration section------ */
 #if TIMER1_MODE_SELECT == TIMER1_MODE_OVER_FLOW
@@ -51,7 +77,7 @@ extern gpio_config_t Ultrasonic_TriggerPin;
  * 				3- Setup the direction of the Trigger pin as Output through the GPIO Driver
  * @param  (ultrasonic_obj)  pointer to the Ultrasonic object passed by reference
  * @return (l_status) 	     status of the performed operation
- *              (E_NOT_OK)  	operation failed
+ *              (E_NOT_OK)  	operation failed (or the clock source of the ICU has no pre-scaler)
  *              (E_OK)      	operation success
  */
 Std_ReturnType Ultrasonic_init(ultrasonic_config_t *ultrasonic_obj);
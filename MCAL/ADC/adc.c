@@ -40,6 +40,11 @@ Std_ReturnType ADC_init(adc_config_t *adc_obj)
 	/* create a local variable to hold the status of the performed operation */
 	Std_ReturnType l_status = ZERO_INIT;
 
+	/* create local variables to hold the images of the ADC Registers and the Special Function IO Register */
+	ADMUX_CFG_t l_admux = { .Byte = ZERO_INIT };
+	ADCSRA_CFG_t l_adcsra = { .Byte = ZERO_INIT };
+	SFIOR_CFG_t l_sfior = { .Byte = ZERO_INIT };
+
 	/* check if the address is valid or not */
 	if(adc_obj == NULL_PTR)
 	{
@@ -55,22 +60,27 @@ Std_ReturnType ADC_init(adc_config_t *adc_obj)
 
 		/* ADC init */
 
+		/* the ADMUX, ADCSRA and SFIOR images are built in local variables then every Register is written once */
+
 		/* --------------------------------- */
 		/* Select Reference Voltage */
-		_ADMUX._REFSx = adc_obj->voltage_reference_selection;
+		l_admux._REFSx = adc_obj->voltage_reference_selection;
 
 		/* Select the Channel */
-		_ADMUX._MUXx = adc_obj->channel;
+		l_admux._MUXx = adc_obj->channel;
 		/* --------------------------------- */
 
 		/* --------------------------------- */
 		/* Select ADC Left/Right Adjust */
-		_ADMUX._ADLAR = adc_obj->adjust_result;
+		l_admux._ADLAR = adc_obj->adjust_result;
 		/* --------------------------------- */
 
 		/* --------------------------------- */
 		/* enable/disable Auto Trigger */
-		_ADCSRA._ADATE = adc_obj->auto_trigger_enable;
+		l_adcsra._ADATE = adc_obj->auto_trigger_enable;
+
+		/* SFIOR is shared with the other peripherals so its image starts from the Register value */
+		l_sfior.Byte = _SFIOR.Byte;
 
 		/* Select Auto Trigger Source if enabled */
 		if(adc_obj->auto_trigger_enable == ADC_AUTO_TRIGGER_ENABLE)
@@ -78,20 +88,22 @@ Std_ReturnType ADC_init(adc_config_t *adc_obj)
 			/* Auto Trigger Source is enabled */
 
 			/* Select Auto Trigger Source */
-			_SFIOR._ADTSx = adc_obj->auto_trigger_source;
+			l_sfior._ADTSx = adc_obj->auto_trigger_source;
 		}
 		else
 		{
 			/* Auto Trigger Source is disabled */
 
 			/* Free Running Mode */
-			_SFIOR._ADTSx = ADC_AUTO_TRIGGER_FREE_RUNNING_MODE;
+			l_sfior._ADTSx = ADC_AUTO_TRIGGER_FREE_RUNNING_MODE;
 		}
+
+		_SFIOR.Byte = l_sfior.Byte;
 		/* --------------------------------- */
 
 		/* --------------------------------- */
 		/* Enable/Disable ADC Interrupt */
-		_ADCSRA._ADIE = adc_obj->interrupt_enable;
+		l_adcsra._ADIE = adc_obj->interrupt_enable;
 
 		/* Set the Call Back Function if ADC Interrupt is enabled */
 		if(adc_obj->interrupt_enable == ADC_INTERRUPT_ENABLE)
@@ -108,12 +120,16 @@ Std_ReturnType ADC_init(adc_config_t *adc_obj)
 
 		/* --------------------------------- */
 		/* ADC Pre-scaler Select */
-		_ADCSRA._ADPSx = adc_obj->prescaler;
+		l_adcsra._ADPSx = adc_obj->prescaler;
 		/* --------------------------------- */
 
 		/* --------------------------------- */
 		/* ADC Enable */
-		ADC_ENABLE();
+		l_adcsra._ADEN = SET;
+
+		/* the channel is selected before the ADC is enabled with its configuration */
+		_ADMUX.Byte = l_admux.Byte;
+		_ADCSRA.Byte = l_adcsra.Byte;
 		/* --------------------------------- */
 	}
 
@@ -27,8 +27,8 @@
 /* ADC (10-bit resolution) */
 #define ADC_MAXIMUM_VALUE    			1023
 
-/* ADC Reference Voltage value */
-#define ADC_REF_VOLTAGE_VALUE			2.56
+/* ADC Reference Voltage value in mV */
+#define ADC_REF_VOLTAGE_MV				2560
 
 /* --------------------------------- */
 /* @ref : ADC Left Adjust Result */
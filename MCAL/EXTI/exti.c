@@ -0,0 +1,381 @@
+/*
+ =========================================================================================
+ Name        : exti.c
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : EXTERNAL INTERRUPT Driver Source file , Ansi-style
+ =========================================================================================
+*/
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include <avr/interrupt.h> 			/* For INT0/INT1/INT2 ISR */
+
+#include "exti.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -------------------Global section-------------------- */
+
+/* create a pointer to function to hold the address of the call back function */
+
+/* INT0 Call Back */
+
+#if EXTI_CFG_INT0_INTERRUPT
+static void (* EXTI_INT0_InterruptHandler)(void) = NULL_PTR;
+#endif
+
+/* INT1 Call Back */
+
+#if EXTI_CFG_INT1_INTERRUPT
+static void (* EXTI_INT1_InterruptHandler)(void) = NULL_PTR;
+#endif
+
+/* INT2 Call Back */
+
+#if EXTI_CFG_INT2_INTERRUPT
+static void (* EXTI_INT2_InterruptHandler)(void) = NULL_PTR;
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  Enable/Disable the External Interrupt Request of an External Interrupt line
+ * @param  (source)   the External Interrupt line >> @ref : exti_source_t
+ * @param  (enable)   >> @ref : INTx: External Interrupt Request Enable
+ */
+static void EXTI_setInterruptEnable(uint8 source , uint8 enable);
+
+
+/**
+ * @brief  Clear the Interrupt Flag of an External Interrupt line
+ * @param  (source)   the External Interrupt line >> @ref : exti_source_t
+ */
+static void EXTI_clearFlag(uint8 source);
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions definition section------------- */
+
+
+/**
+ * @brief  initialize External Interrupt :
+ * 			1- Disable the External Interrupt Request while it's configured
+ * 			2- Initialize the direction of the interrupt pin
+ * 			3- Select the Interrupt Sense Control
+ * 					- Low Level        (INT0/INT1 only)
+ * 					- Any Logical Change (INT0/INT1 only)
+ * 					- Falling Edge
+ * 					- Rising Edge
+ * 			4- Clear the Interrupt Flag
+ * 			5- Set the External Interrupt Call Back
+ * 			6- Enable/Disable the External Interrupt Request
+ * @param  (exti_obj) pointer to the EXTI object passed by reference
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (wrong Sense Control or the line's interrupt is disabled by
+ *                          EXTI_CFG_INTx_INTERRUPT >> the External Interrupt Request stays disabled)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType EXTI_init(const exti_config_t *exti_obj)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the interrupt pin */
+	gpio_config_t l_pin = { .port = EXTI_INT0_PORT_INDEX , .pin = EXTI_INT0_PIN_INDEX , .mode = GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES };
+
+	/* check if the address is valid or not */
+	/* check if the user exceeded the number of External Interrupt lines or not */
+	if( (NULL_PTR == exti_obj) || (exti_obj->source >= EXTI_SOURCE_MAX) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		/* --------------------------------- */
+		/* Disable the External Interrupt Request so no interrupt occurs while it's configured */
+		EXTI_setInterruptEnable(exti_obj->source , EXTI_INTERRUPT_DISABLE);
+		/* --------------------------------- */
+
+		/* --------------------------------- */
+		/* Initialize the direction of the interrupt pin */
+		switch(exti_obj->source)
+		{
+			case EXTI_INT1	:	l_pin.port = EXTI_INT1_PORT_INDEX;
+								l_pin.pin = EXTI_INT1_PIN_INDEX;
+								break;
+
+			case EXTI_INT2	:	l_pin.port = EXTI_INT2_PORT_INDEX;
+								l_pin.pin = EXTI_INT2_PIN_INDEX;
+								break;
+
+			default			:	/* INT0 */
+								break;
+		}
+		l_pin.mode = exti_obj->pin_mode;
+		GPIO_setupPinDirection(&l_pin);
+		/* --------------------------------- */
+
+		/* --------------------------------- */
+		/* Select the Interrupt Sense Control */
+		l_status = EXTI_setSenseControl(exti_obj->source , exti_obj->sense_control);
+		/* --------------------------------- */
+
+		if(E_OK == l_status)
+		{
+			/* --------------------------------- */
+			/* Clear the Interrupt Flag as changing the Interrupt Sense Control may set it */
+			EXTI_clearFlag(exti_obj->source);
+			/* --------------------------------- */
+
+			/* --------------------------------- */
+			/* Set the External Interrupt Call Back (fails if the line's interrupt is disabled by EXTI_CFG_INTx_INTERRUPT) */
+			l_status = EXTI_setCallBack(exti_obj->source , exti_obj->EXTI_DefaultHandler);
+			/* --------------------------------- */
+		}
+		else{ /* Nothing */ }
+
+		/* --------------------------------- */
+		/* Enable/Disable the External Interrupt Request (it stays disabled if any step failed) */
+		if(E_OK == l_status)
+		{
+			EXTI_setInterruptEnable(exti_obj->source , exti_obj->interrupt_en);
+		}
+		else{ /* Nothing */ }
+		/* --------------------------------- */
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  Disable External Interrupt Request and remove its Call Back
+ * @param  (source)   the External Interrupt line >> @ref : exti_source_t
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType EXTI_deInit(uint8 source)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+
+	if(source >= EXTI_SOURCE_MAX)
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		/* Disable the External Interrupt Request */
+		EXTI_setInterruptEnable(source , EXTI_INTERRUPT_DISABLE);
+
+		/* Clear the pending Interrupt Flag */
+		EXTI_clearFlag(source);
+
+		/* Remove the Call Back */
+		l_status = EXTI_setCallBack(source , NULL_PTR);
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  Select the Interrupt Sense Control of an External Interrupt line
+ * @param  (source)   		the External Interrupt line >> @ref : exti_source_t
+ * @param  (sense_control)  the event which triggers the interrupt >> @ref : exti_sense_control_t
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType EXTI_setSenseControl(uint8 source , uint8 sense_control)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = E_OK;
+	/* create a local variable to hold the INT2 Enable */
+	uint8 l_int2_enable = ZERO_INIT;
+
+	switch(source)
+	{
+		case EXTI_INT0	:	/* ISC01:0 */
+							_MCUCR._ISC0x = sense_control;
+							break;
+
+		case EXTI_INT1	:	/* ISC11:0 */
+							_MCUCR._ISC1x = sense_control;
+							break;
+
+		case EXTI_INT2	:	/* INT2 is edge triggered only */
+							if( (EXTI_FALLING_EDGE == sense_control) || (EXTI_RISING_EDGE == sense_control) )
+							{
+								/* INT2 must be disabled while ISC2 is changed then its flag is cleared before it's enabled again */
+								l_int2_enable = _GICR._INT2;
+								_GICR._INT2 = EXTI_INTERRUPT_DISABLE;
+
+								_MCUCSR._ISC2 = (EXTI_RISING_EDGE == sense_control);
+
+								EXTI_clearFlag(EXTI_INT2);
+								_GICR._INT2 = l_int2_enable;
+							}
+							else
+							{
+								l_status = E_NOK;		/* operation failed */
+							}
+							break;
+
+		default			:	l_status = E_NOK;		/* operation failed */
+							break;
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  Set the Call Back of an External Interrupt line
+ * @param  (source)   			the External Interrupt line >> @ref : exti_source_t
+ * @param  (EXTI_Handler)		function to be called when the External Interrupt occurs
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType EXTI_setCallBack(uint8 source , void (* EXTI_Handler)(void))
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = E_OK;
+
+	switch(source)
+	{
+		#if EXTI_CFG_INT0_INTERRUPT
+		case EXTI_INT0	:	EXTI_INT0_InterruptHandler = EXTI_Handler;
+							break;
+		#endif
+
+		#if EXTI_CFG_INT1_INTERRUPT
+		case EXTI_INT1	:	EXTI_INT1_InterruptHandler = EXTI_Handler;
+							break;
+		#endif
+
+		#if EXTI_CFG_INT2_INTERRUPT
+		case EXTI_INT2	:	EXTI_INT2_InterruptHandler = EXTI_Handler;
+							break;
+		#endif
+
+		default			:	l_status = E_NOK;		/* operation failed */
+							break;
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  Enable/Disable the External Interrupt Request of an External Interrupt line
+ * @param  (source)   the External Interrupt line >> @ref : exti_source_t
+ * @param  (enable)   >> @ref : INTx: External Interrupt Request Enable
+ */
+static void EXTI_setInterruptEnable(uint8 source , uint8 enable)
+{
+	switch(source)
+	{
+		case EXTI_INT0	:	_GICR._INT0 = enable;
+							break;
+
+		case EXTI_INT1	:	_GICR._INT1 = enable;
+							break;
+
+		case EXTI_INT2	:	_GICR._INT2 = enable;
+							break;
+
+		default			:	/* Nothing */
+							break;
+	}
+}
+
+
+/**
+ * @brief  Clear the Interrupt Flag of an External Interrupt line
+ * @param  (source)   the External Interrupt line >> @ref : exti_source_t
+ */
+static void EXTI_clearFlag(uint8 source)
+{
+	/* the flags are cleared by writing a logical one so the whole byte is written (read-modify-write would clear the other pending flags) */
+	switch(source)
+	{
+		case EXTI_INT0	:	_GIFR.Byte = EXTI_INT0_FLAG_MASK;
+							break;
+
+		case EXTI_INT1	:	_GIFR.Byte = EXTI_INT1_FLAG_MASK;
+							break;
+
+		case EXTI_INT2	:	_GIFR.Byte = EXTI_INT2_FLAG_MASK;
+							break;
+
+		default			:	/* Nothing */
+							break;
+	}
+}
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------------ISR section---------------------- */
+
+
+#if EXTI_CFG_INT0_INTERRUPT
+/**
+ * @brief  External Interrupt Request 0 ISR
+ */
+ISR(INT0_vect)
+{
+	/* check if the call back notification contains NULL or not */
+	if(EXTI_INT0_InterruptHandler)
+	{
+		/* Call Back */
+		(*EXTI_INT0_InterruptHandler)();
+	}
+	else{ /* Nothing */ }
+}
+#endif
+
+
+#if EXTI_CFG_INT1_INTERRUPT
+/**
+ * @brief  External Interrupt Request 1 ISR
+ */
+ISR(INT1_vect)
+{
+	/* check if the call back notification contains NULL or not */
+	if(EXTI_INT1_InterruptHandler)
+	{
+		/* Call Back */
+		(*EXTI_INT1_InterruptHandler)();
+	}
+	else{ /* Nothing */ }
+}
+#endif
+
+
+#if EXTI_CFG_INT2_INTERRUPT
+/**
+ * @brief  External Interrupt Request 2 ISR
+ */
+ISR(INT2_vect)
+{
+	/* check if the call back notification contains NULL or not */
+	if(EXTI_INT2_InterruptHandler)
+	{
+		/* Call Back */
+		(*EXTI_INT2_InterruptHandler)();
+	}
+	else{ /* Nothing */ }
+}
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
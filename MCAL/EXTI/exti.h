@@ -0,0 +1,166 @@
+/*
+ =========================================================================================
+ Name        : exti.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : EXTERNAL INTERRUPT Driver Header file , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _EXTI_H_
+#define _EXTI_H_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "ATmega32.h"
+#include "gpio.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+
+/* --------------------------------- */
+/* EXTI Configurations Enable/Disable */
+
+#define EXTI_CFG_DISABLE									0
+#define EXTI_CFG_ENABLE										1
+
+/* --------------------------------- */
+/* Enable/Disable the ISR of every External Interrupt line */
+
+#define EXTI_CFG_INT0_INTERRUPT								EXTI_CFG_ENABLE
+#define EXTI_CFG_INT1_INTERRUPT								EXTI_CFG_ENABLE
+#define EXTI_CFG_INT2_INTERRUPT								EXTI_CFG_ENABLE
+
+/* --------------------------------- */
+/* External Interrupt pins */
+
+/* INT0 : PD2 */
+#define EXTI_INT0_PORT_INDEX								GPIO_PORTD
+#define EXTI_INT0_PIN_INDEX									GPIO_PIN2
+
+/* INT1 : PD3 */
+#define EXTI_INT1_PORT_INDEX								GPIO_PORTD
+#define EXTI_INT1_PIN_INDEX									GPIO_PIN3
+
+/* INT2 : PB2 */
+#define EXTI_INT2_PORT_INDEX								GPIO_PORTB
+#define EXTI_INT2_PIN_INDEX									GPIO_PIN2
+
+/* --------------------------------- */
+/* General Interrupt Flag Register masks (a flag is cleared by writing a logical one to it) */
+
+#define EXTI_INT0_FLAG_MASK									0x40
+#define EXTI_INT1_FLAG_MASK									0x80
+#define EXTI_INT2_FLAG_MASK									0x20
+
+/* --------------------------------- */
+/* @ref : INTx: External Interrupt Request Enable */
+
+#define EXTI_INTERRUPT_DISABLE								0
+#define EXTI_INTERRUPT_ENABLE								1
+
+/* --------------------------------- */
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -----user_defined data type declaration section------ */
+
+/* EXTI config structure */
+typedef struct{
+	/* pointer to function to hold the function called in the APPLICATION layer when the External Interrupt occurs */
+	void (* EXTI_DefaultHandler)(void);
+
+	/* selects the External Interrupt line >> @ref : exti_source_t */
+	uint8 source				:2;
+	/* selects the event which triggers the interrupt >> @ref : exti_sense_control_t */
+	uint8 sense_control			:2;
+	/* selects the mode of the interrupt pin >> @ref : gpio mode select */
+	uint8 pin_mode				:2;
+	/* Enable/Disable the External Interrupt Request >> @ref : INTx: External Interrupt Request Enable */
+	uint8 interrupt_en			:1;
+
+	/* Reserved */
+	uint8						:1;
+}exti_config_t;
+
+
+/* @ref : exti_source_t */
+typedef enum{
+	EXTI_INT0 = 0,							/* External Interrupt Request 0 (PD2) */
+	EXTI_INT1,								/* External Interrupt Request 1 (PD3) */
+	EXTI_INT2,								/* External Interrupt Request 2 (PB2) */
+	EXTI_SOURCE_MAX
+}exti_source_t;
+
+/* @ref : exti_sense_control_t */
+typedef enum{
+	EXTI_LOW_LEVEL = 0,						/* The low level of INTx generates an interrupt request (INT0/INT1 only) */
+	EXTI_ANY_LOGICAL_CHANGE,				/* Any logical change on INTx generates an interrupt request (INT0/INT1 only) */
+	EXTI_FALLING_EDGE,						/* The falling edge of INTx generates an interrupt request */
+	EXTI_RISING_EDGE						/* The rising edge of INTx generates an interrupt request */
+}exti_sense_control_t;
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  initialize External Interrupt :
+ * 			1- Disable the External Interrupt Request while it's configured
+ * 			2- Initialize the direction of the interrupt pin
+ * 			3- Select the Interrupt Sense Control
+ * 					- Low Level        (INT0/INT1 only)
+ * 					- Any Logical Change (INT0/INT1 only)
+ * 					- Falling Edge
+ * 					- Rising Edge
+ * 			4- Clear the Interrupt Flag
+ * 			5- Set the External Interrupt Call Back
+ * 			6- Enable/Disable the External Interrupt Request
+ * @param  (exti_obj) pointer to the EXTI object passed by reference
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (wrong Sense Control or the line's interrupt is disabled by
+ *                          EXTI_CFG_INTx_INTERRUPT >> the External Interrupt Request stays disabled)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType EXTI_init(const exti_config_t *exti_obj);
+
+
+/**
+ * @brief  Disable External Interrupt Request and remove its Call Back
+ * @param  (source)   the External Interrupt line >> @ref : exti_source_t
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType EXTI_deInit(uint8 source);
+
+
+/**
+ * @brief  Select the Interrupt Sense Control of an External Interrupt line
+ * @param  (source)   		the External Interrupt line >> @ref : exti_source_t
+ * @param  (sense_control)  the event which triggers the interrupt >> @ref : exti_sense_control_t
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType EXTI_setSenseControl(uint8 source , uint8 sense_control);
+
+
+/**
+ * @brief  Set the Call Back of an External Interrupt line
+ * @param  (source)   			the External Interrupt line >> @ref : exti_source_t
+ * @param  (EXTI_Handler)		function to be called when the External Interrupt occurs
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType EXTI_setCallBack(uint8 source , void (* EXTI_Handler)(void));
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _EXTI_H_ */
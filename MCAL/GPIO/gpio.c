@@ -16,6 +16,54 @@
 #include "common_macros.h"
 
 
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+/* (bus bit , port pin) pair of the bit-scatter plan of a gpio bus >> @ref : gpio_bus_t */
+#define GPIO_BUS_PLAN_PAIR(BIT,PIN)			( (uint8)( ( (BIT) << 4 ) | (PIN) ) )
+#define GPIO_BUS_PLAN_BIT(PAIR)				( (PAIR) >> 4 )
+#define GPIO_BUS_PLAN_PIN(PAIR)				( (PAIR) & 0x0F )
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -------------------Global section-------------------- */
+
+/*
+ * gpio port registers map indexed by the port ID >> @ref : gpio port index
+ * every API uses one indexed access to this table instead of a switch case on the port ID
+ */
+static const gpio_port_registers_t gpio_port_registers[PORT_MAX] = {
+		{ PORTA_ADDRESS , DDRA_ADDRESS , PINA_ADDRESS },		/* GPIO_PORTA */
+		{ PORTB_ADDRESS , DDRB_ADDRESS , PINB_ADDRESS },		/* GPIO_PORTB */
+		{ PORTC_ADDRESS , DDRC_ADDRESS , PINC_ADDRESS },		/* GPIO_PORTC */
+		{ PORTD_ADDRESS , DDRD_ADDRESS , PIND_ADDRESS }		/* GPIO_PORTD */
+};
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  scatter the bus bits carried by a port to their pins in the port
+ * @param  (bus_obj)  pointer to the gpio bus object initialized by GPIO_busInit
+ * @param  (port_num) holds the ID of the port
+ * @param  (value)    holds the bus value
+ * @return the logic values of the port pins used by the bus
+ */
+static uint8 GPIO_busScatter(const gpio_bus_t *bus_obj,uint8 port_num,uint8 value);
+
+
+/**
+ * @brief  gather the bus bits carried by a port from their pins in the port
+ * @param  (bus_obj)    pointer to the gpio bus object initialized by GPIO_busInit
+ * @param  (port_num)   holds the ID of the port
+ * @param  (port_value) holds the logic values read from the port
+ * @return the bus bits carried by the port
+ */
+static uint8 GPIO_busGather(const gpio_bus_t *bus_obj,uint8 port_num,uint8 port_value);
+
+
 /* ----------------------------------------------------------------------------------- */
 /* ------------functions definition section------------- */
 
@@ -34,6 +82,8 @@ Std_ReturnType GPIO_setupPinDirection(gpio_config_t *gpio_obj)
 {
 	/* create a local variable to hold the status of the performed operation */
     Std_ReturnType l_status = ZERO_INIT;
+	/* create a local pointer to hold the registers map of the used port */
+	const gpio_port_registers_t *l_port_regs = NULL_PTR;
 
     /* check if the address is valid or not */
     /* check if the user exceeded the max number of pins or not */
@@ -56,108 +106,127 @@ Std_ReturnType GPIO_setupPinDirection(gpio_config_t *gpio_obj)
         
         /* initialize the direction of the pin */
 		
-		/* check which port is used first */
-		switch(gpio_obj->port)
+		/* get the registers of the used port from the registers map */
+		l_port_regs = &gpio_port_registers[gpio_obj->port];
+		
+		/* check if its output or input */
+		if(gpio_obj->mode == GPIO_MODE_OUTPUT)
+		{
+			/* the pin is set to be output */
+			SET_BIT(IO_REG8(l_port_regs->ddr_address),gpio_obj->pin);
+		}
+		else if(gpio_obj->mode == GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES)
+		{
+			/* the pin is set to be input without internal pull up resistance */
+			CLEAR_BIT(IO_REG8(l_port_regs->ddr_address),gpio_obj->pin);
+			CLEAR_BIT(IO_REG8(l_port_regs->port_address),gpio_obj->pin);
+		}
+		else if(gpio_obj->mode == GPIO_MODE_INPUT_WITH_INTERNAL_PULL_UP_RES)
 		{
-			case GPIO_PORTA	:	/* the pin is is Port A so we will use DDRA Register to set the direction */
-									
-								/* check if its output or input */
-								if(gpio_obj->mode == GPIO_MODE_OUTPUT)
-								{
-									/* the pin is set to be output */
-									SET_BIT(_DDRA.Byte,gpio_obj->pin);
-								}
-								else if(gpio_obj->mode == GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES)
-								{
-									/* the pin is set to be input without internal pull up resistance */
-									CLEAR_BIT(_DDRA.Byte,gpio_obj->pin);
-									CLEAR_BIT(_PORTA.Byte,gpio_obj->pin);
-								}
-								else if(gpio_obj->mode == GPIO_MODE_INPUT_WITH_INTERNAL_PULL_UP_RES)
-								{
-									/* the pin is set to be input with internal pull up resistance */
-									CLEAR_BIT(_DDRA.Byte,gpio_obj->pin);
-									SET_BIT(_PORTA.Byte,gpio_obj->pin);
-								}
-								else{ /* Nothing */ }
-									
-								break;
-									
-			case GPIO_PORTB	:	/* the pin is is Port B so we will use DDRB Register to set the direction */
-									
-								/* check if its output or input */
-								if(gpio_obj->mode == GPIO_MODE_OUTPUT)
-								{
-									/* the pin is set to be output */
-									SET_BIT(_DDRB.Byte,gpio_obj->pin);
-								}
-								else if(gpio_obj->mode == GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES)
-								{
-									/* the pin is set to be input without internal pull up resistance */
-									CLEAR_BIT(_DDRB.Byte,gpio_obj->pin);
-									CLEAR_BIT(_PORTB.Byte,gpio_obj->pin);
-								}
-								else if(gpio_obj->mode == GPIO_MODE_INPUT_WITH_INTERNAL_PULL_UP_RES)
-								{
-									/* the pin is set to be input with internal pull up resistance */
-									CLEAR_BIT(_DDRB.Byte,gpio_obj->pin);
-									SET_BIT(_PORTB.Byte,gpio_obj->pin);
-								}
-								else{ /* Nothing */ }
-									
-								break;
-									
-			case GPIO_PORTC	:	/* the pin is is Port C so we will use DDRC Register to set the direction */
-									
-								/* check if its output or input */
-								if(gpio_obj->mode == GPIO_MODE_OUTPUT)
-								{
-									/* the pin is set to be output */
-									SET_BIT(_DDRC.Byte,gpio_obj->pin);
-								}
-								else if(gpio_obj->mode == GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES)
-								{
-									/* the pin is set to be input without internal pull up resistance */
-									CLEAR_BIT(_DDRC.Byte,gpio_obj->pin);
-									CLEAR_BIT(_PORTC.Byte,gpio_obj->pin);
-								}
-								else if(gpio_obj->mode == GPIO_MODE_INPUT_WITH_INTERNAL_PULL_UP_RES)
-								{
-									/* the pin is set to be input with internal pull up resistance */
-									CLEAR_BIT(_DDRC.Byte,gpio_obj->pin);
-									SET_BIT(_PORTC.Byte,gpio_obj->pin);
-								}
-								else{ /* Nothing */ }
-									
-								break;
-									
-			case GPIO_PORTD	:	/* the pin is is Port D so we will use DDRD Register to set the direction */
-									
-								/* check if its output or input */
-								if(gpio_obj->mode == GPIO_MODE_OUTPUT)
-								{
-									/* the pin is set to be output */
-									SET_BIT(_DDRD.Byte,gpio_obj->pin);
-								}
-								else if(gpio_obj->mode == GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES)
-								{
-									/* the pin is set to be input without internal pull up resistance */
-									CLEAR_BIT(_DDRD.Byte,gpio_obj->pin);
-									CLEAR_BIT(_PORTD.Byte,gpio_obj->pin);
-								}
-								else if(gpio_obj->mode == GPIO_MODE_INPUT_WITH_INTERNAL_PULL_UP_RES)
-								{
-									/* the pin is set to be input with internal pull up resistance */
-									CLEAR_BIT(_DDRD.Byte,gpio_obj->pin);
-									SET_BIT(_PORTD.Byte,gpio_obj->pin);
-								}
-								else{ /* Nothing */ }
-									
-								break;
-									
-			default	:			/* Nothing */
-								break;
+			/* the pin is set to be input with internal pull up resistance */
+			CLEAR_BIT(IO_REG8(l_port_regs->ddr_address),gpio_obj->pin);
+			SET_BIT(IO_REG8(l_port_regs->port_address),gpio_obj->pin);
 		}
+		else{ /* Nothing */ }
+	}
+	
+	return l_status;
+}
+
+
+/**
+ * @brief  initialize the direction of a table of pins (same modes as GPIO_setupPinDirection)
+ * 			the table is folded into one DDR image and one PORT image per port then every used register is written once
+ * @param  (pins_table) pointer to the first gpio pin object of the table
+ * @param  (pins_num)   holds the number of the pins in the table
+ * @return (l_status)   status of the performed operation
+ *              (E_NOT_OK)  operation failed (nothing is written)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType GPIO_setupPinsFromTable(const gpio_config_t *pins_table,uint8 pins_num)
+{
+	/* create a local variable to hold the status of the performed operation */
+    Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the Status Register during the read-modify-write */
+	uint8 l_sreg = ZERO_INIT;
+	/* create a local variable to traverse the table/ports */
+	uint8 l_index = ZERO_INIT;
+	/* create local variables to hold the pins to be set/cleared in DDRx and PORTx Registers of every port */
+	uint8 l_ddr_set[PORT_MAX] = {GPIO_PORT_MASK_ALL_CLEAR};
+	uint8 l_ddr_clear[PORT_MAX] = {GPIO_PORT_MASK_ALL_CLEAR};
+	uint8 l_port_set[PORT_MAX] = {GPIO_PORT_MASK_ALL_CLEAR};
+	uint8 l_port_clear[PORT_MAX] = {GPIO_PORT_MASK_ALL_CLEAR};
+	/* create a local pointer to hold the registers map of the used port */
+	const gpio_port_registers_t *l_port_regs = NULL_PTR;
+
+    /* check if the address is valid or not */
+    if( (pins_table == NULL_PTR) || (pins_num == ZERO_INIT) )
+    {
+        /* NULL pointer is passed or the table is empty */
+        
+        l_status = E_NOK;		/* operation failed */
+    }
+    else
+    {
+        /* the address passed is valid */
+
+        l_status = E_OK;		/* operation success */
+		
+		/* fold the table into the DDR/PORT images of every port */
+		/* NOTE: the pin/port bit-fields of gpio_config_t can't hold a pin/port out of range */
+		for(l_index = 0; l_index < pins_num; l_index++)
+		{
+			if(pins_table[l_index].mode == GPIO_MODE_OUTPUT)
+			{
+				/* the pin is set to be output */
+				SET_BIT(l_ddr_set[pins_table[l_index].port],pins_table[l_index].pin);
+			}
+			else if(pins_table[l_index].mode == GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES)
+			{
+				/* the pin is set to be input without internal pull up resistance */
+				SET_BIT(l_ddr_clear[pins_table[l_index].port],pins_table[l_index].pin);
+				SET_BIT(l_port_clear[pins_table[l_index].port],pins_table[l_index].pin);
+			}
+			else if(pins_table[l_index].mode == GPIO_MODE_INPUT_WITH_INTERNAL_PULL_UP_RES)
+			{
+				/* the pin is set to be input with internal pull up resistance */
+				SET_BIT(l_ddr_clear[pins_table[l_index].port],pins_table[l_index].pin);
+				SET_BIT(l_port_set[pins_table[l_index].port],pins_table[l_index].pin);
+			}
+			else{ /* Nothing */ }
+		}
+		
+		/* write the DDR/PORT images of every used port once */
+		if(l_status == E_OK)
+		{
+			/* disable the interrupts so an ISR can't change the ports between the read and the write */
+			CRITICAL_SECTION_ENTER(l_sreg);
+			
+			for(l_index = 0; l_index < PORT_MAX; l_index++)
+			{
+				l_port_regs = &gpio_port_registers[l_index];
+				
+				/* DDRx Register is written only if the table has pins in this port */
+				if( (l_ddr_set[l_index] | l_ddr_clear[l_index]) != GPIO_PORT_MASK_ALL_CLEAR )
+				{
+					IO_REG8(l_port_regs->ddr_address) =
+							( IO_REG8(l_port_regs->ddr_address) & (uint8)(~l_ddr_clear[l_index]) ) | l_ddr_set[l_index];
+				}
+				else{ /* Nothing */ }
+				
+				/* PORTx Register is written only if the table has input pins in this port */
+				if( (l_port_set[l_index] | l_port_clear[l_index]) != GPIO_PORT_MASK_ALL_CLEAR )
+				{
+					IO_REG8(l_port_regs->port_address) =
+							( IO_REG8(l_port_regs->port_address) & (uint8)(~l_port_clear[l_index]) ) | l_port_set[l_index];
+				}
+				else{ /* Nothing */ }
+			}
+			
+			/* restore the interrupts status */
+			CRITICAL_SECTION_EXIT(l_sreg);
+		}
+		else{ /* Nothing */ }
 	}
 	
 	return l_status;
@@ -198,108 +267,25 @@ Std_ReturnType GPIO_writePin(gpio_config_t *gpio_obj,uint8 logic)
         
         /* set the logic out from the pin */
 		
-		/* check which port is used first */
-		switch(gpio_obj->port)
+		/* check if its output or input */
+		if(gpio_obj->mode == GPIO_MODE_OUTPUT)
 		{
-			case GPIO_PORTA	:	/* the pin is in Port A so we will use PORTA Register to set the logic */
-									
-								/* check if its output or input */
-								if(gpio_obj->mode == GPIO_MODE_OUTPUT)
-								{
-									/* the pin is set to be output */
-
-									/* set the logic */
-									if(logic == GPIO_HIGH)
-									{
-										/* write logic 1 on the pin */
-										SET_BIT(_PORTA.Byte,gpio_obj->pin);
-									}
-									else if(logic == GPIO_LOW)
-									{
-										/* write logic 0 on the pin */
-										CLEAR_BIT(_PORTA.Byte,gpio_obj->pin);
-									}
-									else{ /* Nothing */ }
-								}
-								else{ /* Nothing */ }
-									
-								break;
-									
-			case GPIO_PORTB	:	/* the pin is in Port B so we will use PORTB Register to set the logic */
-									
-								/* check if its output or input */
-								if(gpio_obj->mode == GPIO_MODE_OUTPUT)
-								{
-									/* the pin is set to be output */
-
-									/* set the logic */
-									if(logic == GPIO_HIGH)
-									{
-										/* write logic 1 on the pin */
-										SET_BIT(_PORTB.Byte,gpio_obj->pin);
-									}
-									else if(logic == GPIO_LOW)
-									{
-										/* write logic 0 on the pin */
-										CLEAR_BIT(_PORTB.Byte,gpio_obj->pin);
-									}
-									else{ /* Nothing */ }
-								}
-								else{ /* Nothing */ }
-									
-								break;
-									
-			case GPIO_PORTC	:	/* the pin is in Port C so we will use PORTC Register to set the logic */
-									
-								/* check if its output or input */
-								if(gpio_obj->mode == GPIO_MODE_OUTPUT)
-								{
-									/* the pin is set to be output */
-
-									/* set the logic */
-									if(logic == GPIO_HIGH)
-									{
-										/* write logic 1 on the pin */
-										SET_BIT(_PORTC.Byte,gpio_obj->pin);
-									}
-									else if(logic == GPIO_LOW)
-									{
-										/* write logic 0 on the pin */
-										CLEAR_BIT(_PORTC.Byte,gpio_obj->pin);
-									}
-									else{ /* Nothing */ }
-								}
-								else{ /* Nothing */ }
-									
-								break;
-									
-			case GPIO_PORTD	:	/* the pin is in Port D so we will use PORTD Register to set the logic */
-									
-								/* check if its output or input */
-								if(gpio_obj->mode == GPIO_MODE_OUTPUT)
-								{
-									/* the pin is set to be output */
-
-									/* set the logic */
-									if(logic == GPIO_HIGH)
-									{
-										/* write logic 1 on the pin */
-										SET_BIT(_PORTD.Byte,gpio_obj->pin);
-									}
-									else if(logic == GPIO_LOW)
-									{
-										/* write logic 0 on the pin */
-										CLEAR_BIT(_PORTD.Byte,gpio_obj->pin);
-									}
-									else{ /* Nothing */ }
-								}
-								else{ /* Nothing */ }
-									
-								break;
-									
-			default	:			/* Nothing */
-								break;
+			/* the pin is set to be output so we will use PORTx Register of the used port to set the logic */
+
+			/* set the logic */
+			if(logic == GPIO_HIGH)
+			{
+				/* write logic 1 on the pin */
+				SET_BIT(IO_REG8(gpio_port_registers[gpio_obj->port].port_address),gpio_obj->pin);
+			}
+			else if(logic == GPIO_LOW)
+			{
+				/* write logic 0 on the pin */
+				CLEAR_BIT(IO_REG8(gpio_port_registers[gpio_obj->port].port_address),gpio_obj->pin);
+			}
+			else{ /* Nothing */ }
 		}
+		else{ /* Nothing */ }
 	}
 	
 	return l_status;
@@ -337,75 +323,16 @@ uint8 GPIO_readPin(gpio_config_t *gpio_obj)
         
         /* get the logic of the pin */
 		
-		/* check which port is used first */
-		switch(gpio_obj->port)
+		/* check if the logic reading in the PINx Register of the used port is HIGH/LOW */
+		if( BIT_IS_SET(IO_REG8(gpio_port_registers[gpio_obj->port].pin_address),gpio_obj->pin) )
 		{
-			case GPIO_PORTA	:	/* the pin is is Port A so we will use PINA Register to get the logic */
-									
-								/* check if the logic reading in the PINA Register is HIGH/LOW */
-								if( BIT_IS_SET(_PINA.Byte,gpio_obj->pin) )
-								{
-									/* logic 1 is read from PINA Register */
-									logic = GPIO_HIGH;
-								}
-								else
-								{
-									/* logic 0 is read from PINA Register */
-									logic = GPIO_LOW;
-								}
-									
-								break;
-									
-			case GPIO_PORTB	:	/* the pin is is Port B so we will use PINB Register to get the logic */
-									
-								/* check if the logic reading in the PINB Register is HIGH/LOW */
-								if( BIT_IS_SET(_PINB.Byte,gpio_obj->pin) )
-								{
-									/* logic 1 is read from PINB Register */
-									logic = GPIO_HIGH;
-								}
-								else
-								{
-									/* logic 0 is read from PINB Register */
-									logic = GPIO_LOW;
-								}
-									
-								break;
-									
-			case GPIO_PORTC	:	/* the pin is is Port C so we will use PINC Register to get the logic */
-									
-								/* check if the logic reading in the PINC Register is HIGH/LOW */
-								if( BIT_IS_SET(_PINC.Byte,gpio_obj->pin) )
-								{
-									/* logic 1 is read from PINC Register */
-									logic = GPIO_HIGH;
-								}
-								else
-								{
-									/* logic 0 is read from PINC Register */
-									logic = GPIO_LOW;
-								}
-									
-								break;
-									
-			case GPIO_PORTD	:	/* the pin is is Port D so we will use PIND Register to get the logic */
-									
-								/* check if the logic reading in the PIND Register is HIGH/LOW */
-								if( BIT_IS_SET(_PIND.Byte,gpio_obj->pin) )
-								{
-									/* logic 1 is read from PIND Register */
-									logic = GPIO_HIGH;
-								}
-								else
-								{
-									/* logic 0 is read from PIND Register */
-									logic = GPIO_LOW;
-								}
-									
-								break;
-									
-			default	:			/* Nothing */
-								break;
+			/* logic 1 is read from PINx Register */
+			logic = GPIO_HIGH;
+		}
+		else
+		{
+			/* logic 0 is read from PINx Register */
+			logic = GPIO_LOW;
 		}
 	}
 	
@@ -413,6 +340,83 @@ uint8 GPIO_readPin(gpio_config_t *gpio_obj)
 }
 
 
+/**
+ * @brief  validate a pin object once and build its handle for the Fast APIs
+ * @param  (gpio_obj)   pointer to the gpio pin object passed by reference
+ * @param  (pin_handle) pointer to the handle to be built
+ * @return (l_status)   status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType GPIO_pinHandleInit(const gpio_config_t *gpio_obj,gpio_pin_handle_t *pin_handle)
+{
+	/* create a local variable to hold the status of the performed operation */
+    Std_ReturnType l_status = ZERO_INIT;
+
+    /* check if the addresses are valid or not */
+    /* NOTE: the pin/port bit-fields of gpio_config_t can't hold a pin/port out of range */
+    if( (gpio_obj == NULL_PTR) || (pin_handle == NULL_PTR) )
+    {
+        l_status = E_NOK;		/* operation failed */
+    }
+    else
+    {
+        l_status = E_OK;		/* operation success */
+
+		/* take the registers of the pin from the registers map and precompute its mask */
+		pin_handle->port_address = gpio_port_registers[gpio_obj->port].port_address;
+		pin_handle->pin_address = gpio_port_registers[gpio_obj->port].pin_address;
+		pin_handle->mask = (uint8)(1 << gpio_obj->pin);
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  write logic HIGH/LOW on a pin through its handle
+ * 			NOTE: no checks are done, the handle must be built by GPIO_pinHandleInit
+ * @param  (pin_handle) pointer to the pin handle
+ * @param  (logic)      holds the logic value (HIGH/LOW) to be written on the pin
+ */
+void GPIO_writePinFast(const gpio_pin_handle_t *pin_handle,uint8 logic)
+{
+	if(logic == GPIO_LOW)
+	{
+		IO_REG8(pin_handle->port_address) &= (uint8)(~pin_handle->mask);
+	}
+	else
+	{
+		IO_REG8(pin_handle->port_address) |= pin_handle->mask;
+	}
+}
+
+
+/**
+ * @brief  toggle the logic of a pin through its handle
+ * 			NOTE: no checks are done, the handle must be built by GPIO_pinHandleInit
+ * @param  (pin_handle) pointer to the pin handle
+ */
+void GPIO_togglePinFast(const gpio_pin_handle_t *pin_handle)
+{
+	IO_REG8(pin_handle->port_address) ^= pin_handle->mask;
+}
+
+
+/**
+ * @brief  read logic from a pin through its handle
+ * 			NOTE: no checks are done, the handle must be built by GPIO_pinHandleInit
+ * @param  (pin_handle) pointer to the pin handle
+ * @return (logic)      the logic status of the pin
+ *              (GPIO_LOW)  	read logic 0
+ *              (GPIO_HIGH)		read logic 1
+ */
+uint8 GPIO_readPinFast(const gpio_pin_handle_t *pin_handle)
+{
+	return ( (IO_REG8(pin_handle->pin_address) & pin_handle->mask) ? GPIO_HIGH : GPIO_LOW );
+}
+
+
 /**
  * @brief  initialize the direction of the port to be one of the following modes :
  *				1- Output mode
@@ -428,6 +432,8 @@ Std_ReturnType GPIO_setupPortDirection(uint8 port_num,uint8 direction)
 {
 	/* create a local variable to hold the status of the performed operation */
     Std_ReturnType l_status = ZERO_INIT;
+	/* create a local pointer to hold the registers map of the used port */
+	const gpio_port_registers_t *l_port_regs = NULL_PTR;
 
     /* check if the user exceeded the max number of ports or not */
     if(port_num >= PORT_MAX)
@@ -444,108 +450,28 @@ Std_ReturnType GPIO_setupPortDirection(uint8 port_num,uint8 direction)
 		
 		/* initialize the direction of the port */
 		
-		/* check which port is used first */
-		switch(port_num)
+		/* get the registers of the used port from the registers map */
+		l_port_regs = &gpio_port_registers[port_num];
+		
+		/* check if its output or input */
+		if(direction == GPIO_MODE_OUTPUT)
 		{
-			case GPIO_PORTA	:	/* Port A so we will use DDRA Register to set the direction */
-									
-								/* check if its output or input */
-								if(direction == GPIO_MODE_OUTPUT)
-								{
-									/* the port is set to be output */
-									_DDRA.Byte = GPIO_PORT_OUTPUT;
-								}
-								else if(direction == GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES)
-								{
-									/* the port is set to be input without internal pull up resistance */
-									_DDRA.Byte = GPIO_PORT_INPUT;
-									_PORTA.Byte = GPIO_PORT_MASK_ALL_CLEAR;
-								}
-								else if(direction == GPIO_MODE_INPUT_WITH_INTERNAL_PULL_UP_RES)
-								{
-									/* the port is set to be input with internal pull up resistance */
-									_DDRA.Byte = GPIO_PORT_INPUT;
-									_PORTA.Byte = GPIO_PORT_MASK_ALL_SET;
-								}
-								else{ /* Nothing */ }
-									
-								break;
-									
-			case GPIO_PORTB	:	/* Port B so we will use DDRB Register to set the direction */
-									
-								/* check if its output or input */
-								if(direction == GPIO_MODE_OUTPUT)
-								{
-									/* the port is set to be output */
-									_DDRB.Byte = GPIO_PORT_OUTPUT;
-								}
-								else if(direction == GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES)
-								{
-									/* the port is set to be input without internal pull up resistance */
-									_DDRB.Byte = GPIO_PORT_INPUT;
-									_PORTB.Byte = GPIO_PORT_MASK_ALL_CLEAR;
-								}
-								else if(direction == GPIO_MODE_INPUT_WITH_INTERNAL_PULL_UP_RES)
-								{
-									/* the port is set to be input with internal pull up resistance */
-									_DDRB.Byte = GPIO_PORT_INPUT;
-									_PORTB.Byte = GPIO_PORT_MASK_ALL_SET;
-								}
-								else{ /* Nothing */ }
-									
-								break;
-									
-			case GPIO_PORTC	:	/* Port C so we will use DDRC Register to set the direction */
-									
-								/* check if its output or input */
-								if(direction == GPIO_MODE_OUTPUT)
-								{
-									/* the port is set to be output */
-									_DDRC.Byte = GPIO_PORT_OUTPUT;
-								}
-								else if(direction == GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES)
-								{
-									/* the port is set to be input without internal pull up resistance */
-									_DDRC.Byte = GPIO_PORT_INPUT;
-									_PORTC.Byte = GPIO_PORT_MASK_ALL_CLEAR;
-								}
-								else if(direction == GPIO_MODE_INPUT_WITH_INTERNAL_PULL_UP_RES)
-								{
-									/* the port is set to be input with internal pull up resistance */
-									_DDRC.Byte = GPIO_PORT_INPUT;
-									_PORTC.Byte = GPIO_PORT_MASK_ALL_SET;
-								}
-								else{ /* Nothing */ }
-									
-								break;
-									
-			case GPIO_PORTD	:	/* Port D so we will use DDRD Register to set the direction */
-									
-								/* check if its output or input */
-								if(direction == GPIO_MODE_OUTPUT)
-								{
-									/* the port is set to be output */
-									_DDRD.Byte = GPIO_PORT_OUTPUT;
-								}
-								else if(direction == GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES)
-								{
-									/* the port is set to be input without internal pull up resistance */
-									_DDRD.Byte = GPIO_PORT_INPUT;
-									_PORTD.Byte = GPIO_PORT_MASK_ALL_CLEAR;
-								}
-								else if(direction == GPIO_MODE_INPUT_WITH_INTERNAL_PULL_UP_RES)
-								{
-									/* the port is set to be input with internal pull up resistance */
-									_DDRD.Byte = GPIO_PORT_INPUT;
-									_PORTD.Byte = GPIO_PORT_MASK_ALL_SET;
-								}
-								else{ /* Nothing */ }
-									
-								break;
-									
-			default	:			/* Nothing */
-								break;
+			/* the port is set to be output */
+			IO_REG8(l_port_regs->ddr_address) = GPIO_PORT_OUTPUT;
 		}
+		else if(direction == GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES)
+		{
+			/* the port is set to be input without internal pull up resistance */
+			IO_REG8(l_port_regs->ddr_address) = GPIO_PORT_INPUT;
+			IO_REG8(l_port_regs->port_address) = GPIO_PORT_MASK_ALL_CLEAR;
+		}
+		else if(direction == GPIO_MODE_INPUT_WITH_INTERNAL_PULL_UP_RES)
+		{
+			/* the port is set to be input with internal pull up resistance */
+			IO_REG8(l_port_regs->ddr_address) = GPIO_PORT_INPUT;
+			IO_REG8(l_port_regs->port_address) = GPIO_PORT_MASK_ALL_SET;
+		}
+		else{ /* Nothing */ }
 	}
 	
 	return l_status;
@@ -578,42 +504,8 @@ Std_ReturnType GPIO_writePort(uint8 port_num,uint8 logic)
 
         l_status = E_OK;		/* operation success */
 		
-		/* set the logic out from the port */
-		
-		/* check which port is used first */
-		switch(port_num)
-		{
-			case GPIO_PORTA	:	/* Port A so we will use PORTA Register to set the logic */
-									
-								/* set the logic */
-								_PORTA.Byte = logic;
-									
-								break;
-									
-			case GPIO_PORTB	:	/* Port B so we will use PORTB Register to set the logic */
-									
-								/* set the logic */
-								_PORTB.Byte = logic;
-									
-								break;
-									
-			case GPIO_PORTC	:	/* Port C so we will use PORTC Register to set the logic */
-									
-								/* set the logic */
-								_PORTC.Byte = logic;
-									
-								break;
-									
-			case GPIO_PORTD	:	/* Port D so we will use PORTD Register to set the logic */
-									
-								/* set the logic */
-								_PORTD.Byte = logic;
-									
-								break;
-									
-			default	:			/* Nothing */
-								break;
-		}
+		/* set the logic out from the port using PORTx Register of the used port */
+		IO_REG8(gpio_port_registers[port_num].port_address) = logic;
 	}
 	
 	return l_status;
@@ -642,45 +534,439 @@ uint8 GPIO_readPort(uint8 port_num)
     {
         /* port number inserted is within the range of ports */
 		
-		/* get the logic of the port */
+		/* get the logic of the port using PINx Register of the used port */
+		logic = IO_REG8(gpio_port_registers[port_num].pin_address);
+	}
+	
+	return logic;
+}
+
+
+/**
+ * @brief  read the logic of all the ports sampled back-to-back
+ * @return 32-bit input vector (PINA is the least significant byte, pin (x) of port (y) is bit (8 * y + x))
+ */
+uint32 GPIO_readAllPorts(void)
+{
+	/* create local variables to hold the logic of the ports */
+	uint8 l_pina = ZERO_INIT;
+	uint8 l_pinb = ZERO_INIT;
+	uint8 l_pinc = ZERO_INIT;
+	uint8 l_pind = ZERO_INIT;
+	
+	/* sample the PINx Registers first so the four reads are back-to-back (constant addresses >> one instruction each) */
+	l_pina = GPIO_PIN_REG(GPIO_PORTA);
+	l_pinb = GPIO_PIN_REG(GPIO_PORTB);
+	l_pinc = GPIO_PIN_REG(GPIO_PORTC);
+	l_pind = GPIO_PIN_REG(GPIO_PORTD);
+	
+	/* then pack them in the input vector */
+	return ( ( (uint32)l_pind << (3 * GPIO_PORT_BITS) ) |
+			 ( (uint32)l_pinc << (2 * GPIO_PORT_BITS) ) |
+			 ( (uint32)l_pinb << (1 * GPIO_PORT_BITS) ) |
+			 ( (uint32)l_pina ) );
+}
+
+
+/**
+ * @brief  write logic HIGH/LOW on the pins of a specific port selected by a mask without changing the other pins
+ * 			(one interrupt safe read-modify-write on the port)
+ * @param  (port_num) holds the ID of the port to be set
+ * @param  (mask)     holds the pins to be written (bit = 1 >> pin is written, bit = 0 >> pin is not changed)
+ * @param  (logic)    holds the logic values (HIGH/LOW) to be written on the selected pins
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType GPIO_writePortMasked(uint8 port_num,uint8 mask,uint8 logic)
+{
+	/* create a local variable to hold the status of the performed operation */
+    Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the Status Register during the read-modify-write */
+	uint8 l_sreg = ZERO_INIT;
+
+    /* check if the user exceeded the max number of ports or not */
+    if(port_num >= PORT_MAX)
+    {
+        /* port number inserted higher than the maximum number of ports */
+        
+        l_status = E_NOK;		/* operation failed */
+    }
+    else
+    {
+        /* port number inserted is within the range of ports */
+
+        l_status = E_OK;		/* operation success */
+		
+		/* disable the interrupts so an ISR can't change the port between the read and the write */
+		CRITICAL_SECTION_ENTER(l_sreg);
+		
+		/* write the selected pins and keep the other pins of PORTx Register of the used port */
+		IO_REG8(gpio_port_registers[port_num].port_address) =
+				( IO_REG8(gpio_port_registers[port_num].port_address) & (uint8)(~mask) ) | (logic & mask);
 		
-		/* check which port is used first */
-		switch(port_num)
+		/* restore the interrupts status */
+		CRITICAL_SECTION_EXIT(l_sreg);
+	}
+	
+	return l_status;
+}
+
+
+/**
+ * @brief  write logic HIGH on the pins of a specific port selected by a mask without changing the other pins
+ * 			(one interrupt safe read-modify-write on the port)
+ * @param  (port_num) holds the ID of the port to be set
+ * @param  (mask)     holds the pins to be set (bit = 1 >> pin is set, bit = 0 >> pin is not changed)
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType GPIO_setPortBits(uint8 port_num,uint8 mask)
+{
+	/* create a local variable to hold the status of the performed operation */
+    Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the Status Register during the read-modify-write */
+	uint8 l_sreg = ZERO_INIT;
+
+    /* check if the user exceeded the max number of ports or not */
+    if(port_num >= PORT_MAX)
+    {
+        /* port number inserted higher than the maximum number of ports */
+        
+        l_status = E_NOK;		/* operation failed */
+    }
+    else
+    {
+        /* port number inserted is within the range of ports */
+
+        l_status = E_OK;		/* operation success */
+		
+		/* disable the interrupts so an ISR can't change the port between the read and the write */
+		CRITICAL_SECTION_ENTER(l_sreg);
+		
+		/* set the selected pins of PORTx Register of the used port */
+		IO_REG8(gpio_port_registers[port_num].port_address) |= mask;
+		
+		/* restore the interrupts status */
+		CRITICAL_SECTION_EXIT(l_sreg);
+	}
+	
+	return l_status;
+}
+
+
+/**
+ * @brief  write logic LOW on the pins of a specific port selected by a mask without changing the other pins
+ * 			(one interrupt safe read-modify-write on the port)
+ * @param  (port_num) holds the ID of the port to be set
+ * @param  (mask)     holds the pins to be cleared (bit = 1 >> pin is cleared, bit = 0 >> pin is not changed)
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType GPIO_clearPortBits(uint8 port_num,uint8 mask)
+{
+	/* create a local variable to hold the status of the performed operation */
+    Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the Status Register during the read-modify-write */
+	uint8 l_sreg = ZERO_INIT;
+
+    /* check if the user exceeded the max number of ports or not */
+    if(port_num >= PORT_MAX)
+    {
+        /* port number inserted higher than the maximum number of ports */
+        
+        l_status = E_NOK;		/* operation failed */
+    }
+    else
+    {
+        /* port number inserted is within the range of ports */
+
+        l_status = E_OK;		/* operation success */
+		
+		/* disable the interrupts so an ISR can't change the port between the read and the write */
+		CRITICAL_SECTION_ENTER(l_sreg);
+		
+		/* clear the selected pins of PORTx Register of the used port */
+		IO_REG8(gpio_port_registers[port_num].port_address) &= (uint8)(~mask);
+		
+		/* restore the interrupts status */
+		CRITICAL_SECTION_EXIT(l_sreg);
+	}
+	
+	return l_status;
+}
+
+
+/**
+ * @brief  initialize the gpio bus :
+ * 				1- Setup the direction of every pin of the bus
+ * 				2- Compute the bit-scatter plan of the bus (pins mask, bus bits, shift and (bus bit , port pin) pairs of every port)
+ * @param  (bus_obj)  pointer to the gpio bus object passed by reference
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType GPIO_busInit(gpio_bus_t *bus_obj)
+{
+	/* create a local variable to hold the status of the performed operation */
+    Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to traverse the bus pins */
+	uint8 l_bit = ZERO_INIT;
+	/* create a local variable to traverse the ports */
+	uint8 l_port = ZERO_INIT;
+	/* create a local variable to hold the distance between the bus bit and its port pin */
+	sint8 l_shift = ZERO_INIT;
+	/* create a local variable to fill the (bus bit , port pin) pairs */
+	uint8 l_pair = ZERO_INIT;
+
+    /* check if the address is valid or not */
+    /* check if the bus size is within the range of the bus pins */
+    if( (bus_obj == NULL_PTR) || (bus_obj->size == ZERO_INIT) || (bus_obj->size > GPIO_BUS_MAX_SIZE) )
+    {
+        /* NULL pointer is passed */
+        /* bus size is zero or higher than the maximum number of bus pins */
+        
+        l_status = E_NOK;		/* operation failed */
+    }
+    else
+    {
+        /* the address passed is valid */
+        /* bus size is within the range of bus pins */
+
+        l_status = E_OK;		/* operation success */
+		
+		/* clear the bit-scatter plan */
+		for(l_port = 0; l_port < PORT_MAX; l_port++)
+		{
+			bus_obj->port_mask[l_port] = GPIO_PORT_MASK_ALL_CLEAR;
+			bus_obj->bus_mask[l_port] = GPIO_PORT_MASK_ALL_CLEAR;
+			bus_obj->shift[l_port] = ZERO_INIT;
+		}
+		
+		/* setup the direction of all the bus pins in one step */
+		l_status = GPIO_setupPinsFromTable( bus_obj->pins , bus_obj->size );
+		
+		/* add every bus pin to the plan of its port */
+		for(l_bit = 0; (l_bit < bus_obj->size) && (l_status == E_OK); l_bit++)
+		{
+			l_port = bus_obj->pins[l_bit].port;
+			l_shift = (sint8)bus_obj->pins[l_bit].pin - (sint8)l_bit;
+			
+			/* check if the bus bits of the port keep the same distance to their port pins */
+			if(bus_obj->bus_mask[l_port] == GPIO_PORT_MASK_ALL_CLEAR)
+			{
+				/* first bus bit in this port */
+				bus_obj->shift[l_port] = l_shift;
+			}
+			else if(bus_obj->shift[l_port] != l_shift)
+			{
+				/* different distance so the bus bits of this port will be scattered bit by bit */
+				bus_obj->shift[l_port] = GPIO_BUS_NO_SHIFT;
+			}
+			else{ /* Nothing */ }
+			
+			/* add the pin and the bus bit to the plan of the port */
+			SET_BIT(bus_obj->port_mask[l_port],bus_obj->pins[l_bit].pin);
+			SET_BIT(bus_obj->bus_mask[l_port],l_bit);
+		}
+		
+		/* group the (bus bit , port pin) pairs port by port so a port with no shift moves only its own bus bits */
+		for(l_port = 0; l_port < PORT_MAX; l_port++)
 		{
-			case GPIO_PORTA	:	/* Port A so we will use PINA Register to get the logic */
-									
-								/* get the logic */
-								logic = _PINA.Byte;
-									
-								break;
-									
-			case GPIO_PORTB	:	/* Port B so we will use PINB Register to get the logic */
-									
-								/* get the logic */
-								logic = _PINB.Byte;
-									
-								break;
-									
-			case GPIO_PORTC	:	/* Port C so we will use PINC Register to get the logic */
-									
-								/* get the logic */
-								logic = _PINC.Byte;
-									
-								break;
-									
-			case GPIO_PORTD	:	/* Port D so we will use PIND Register to get the logic */
-									
-								/* get the logic */
-								logic = _PIND.Byte;
-									
-								break;
-									
-			default	:			/* Nothing */
-								break;
+			bus_obj->plan_first[l_port] = l_pair;
+			
+			for(l_bit = 0; l_bit < bus_obj->size; l_bit++)
+			{
+				if(bus_obj->pins[l_bit].port == l_port)
+				{
+					bus_obj->plan[l_pair] = GPIO_BUS_PLAN_PAIR(l_bit,bus_obj->pins[l_bit].pin);
+					l_pair++;
+				}
+				else{ /* Nothing */ }
+			}
 		}
+		bus_obj->plan_first[PORT_MAX] = l_pair;
 	}
 	
-	return logic;
+	return l_status;
+}
+
+
+/**
+ * @brief  write a value on the gpio bus (bit (i) of the value is written on pins[i])
+ * 			every used port is written once through GPIO_writePortMasked
+ * @param  (bus_obj)  pointer to the gpio bus object initialized by GPIO_busInit
+ * @param  (value)    holds the value to be written on the bus
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType GPIO_busWrite(const gpio_bus_t *bus_obj,uint8 value)
+{
+	/* create a local variable to hold the status of the performed operation */
+    Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to traverse the ports */
+	uint8 l_port = ZERO_INIT;
+
+    /* check if the address is valid or not */
+    if(bus_obj == NULL_PTR)
+    {
+        /* NULL pointer is passed */
+        
+        l_status = E_NOK;		/* operation failed */
+    }
+    else
+    {
+        /* the address passed is valid */
+
+        l_status = E_OK;		/* operation success */
+		
+		/* write the bus bits of every used port in one step */
+		for(l_port = 0; l_port < PORT_MAX; l_port++)
+		{
+			if(bus_obj->port_mask[l_port] != GPIO_PORT_MASK_ALL_CLEAR)
+			{
+				GPIO_writePortMasked( l_port , bus_obj->port_mask[l_port] , GPIO_busScatter(bus_obj,l_port,value) );
+			}
+			else{ /* Nothing */ }
+		}
+	}
+	
+	return l_status;
+}
+
+
+/**
+ * @brief  read a value from the gpio bus (bit (i) of the value is read from pins[i])
+ * 			every used port is read once
+ * @param  (bus_obj)  pointer to the gpio bus object initialized by GPIO_busInit
+ * @return (value)    the value read from the bus
+ *              (GPIO_PORT_MASK_ALL_CLEAR)  	if NULL pointer is passed
+ */
+uint8 GPIO_busRead(const gpio_bus_t *bus_obj)
+{
+	/* create a local variable to hold the value of the bus */
+	uint8 value = GPIO_PORT_MASK_ALL_CLEAR;
+	/* create a local variable to traverse the ports */
+	uint8 l_port = ZERO_INIT;
+
+    /* check if the address is valid or not */
+    if(bus_obj == NULL_PTR)
+    {
+        /* NULL pointer is passed */
+		
+		value = GPIO_PORT_MASK_ALL_CLEAR;
+    }
+    else
+    {
+        /* the address passed is valid */
+		
+		/* read every used port once and gather its bus bits */
+		for(l_port = 0; l_port < PORT_MAX; l_port++)
+		{
+			if(bus_obj->port_mask[l_port] != GPIO_PORT_MASK_ALL_CLEAR)
+			{
+				value |= GPIO_busGather( bus_obj , l_port , IO_REG8(gpio_port_registers[l_port].pin_address) );
+			}
+			else{ /* Nothing */ }
+		}
+	}
+	
+	return value;
+}
+
+
+/**
+ * @brief  scatter the bus bits carried by a port to their pins in the port
+ * @param  (bus_obj)  pointer to the gpio bus object initialized by GPIO_busInit
+ * @param  (port_num) holds the ID of the port
+ * @param  (value)    holds the bus value
+ * @return the logic values of the port pins used by the bus
+ */
+static uint8 GPIO_busScatter(const gpio_bus_t *bus_obj,uint8 port_num,uint8 value)
+{
+	/* create a local variable to hold the logic values of the port pins */
+	uint8 port_value = GPIO_PORT_MASK_ALL_CLEAR;
+	/* create a local variable to traverse the (bus bit , port pin) pairs of the port */
+	uint8 l_pair = ZERO_INIT;
+	/* get the distance between the bus bits and the port pins */
+	sint8 l_shift = bus_obj->shift[port_num];
+
+	/* keep only the bus bits carried by this port */
+	value &= bus_obj->bus_mask[port_num];
+
+	if(l_shift == GPIO_BUS_NO_SHIFT)
+	{
+		/* move the bus bits of this port one by one to their port pins */
+		for(l_pair = bus_obj->plan_first[port_num]; l_pair < bus_obj->plan_first[port_num + 1]; l_pair++)
+		{
+			if( BIT_IS_SET(value,GPIO_BUS_PLAN_BIT(bus_obj->plan[l_pair])) )
+			{
+				SET_BIT(port_value,GPIO_BUS_PLAN_PIN(bus_obj->plan[l_pair]));
+			}
+			else{ /* Nothing */ }
+		}
+	}
+	else if(l_shift >= 0)
+	{
+		/* all the bus bits are moved to their port pins by one shift */
+		port_value = (uint8)(value << l_shift);
+	}
+	else
+	{
+		/* all the bus bits are moved to their port pins by one shift */
+		port_value = (uint8)(value >> (-l_shift));
+	}
+
+	return port_value;
+}
+
+
+/**
+ * @brief  gather the bus bits carried by a port from their pins in the port
+ * @param  (bus_obj)    pointer to the gpio bus object initialized by GPIO_busInit
+ * @param  (port_num)   holds the ID of the port
+ * @param  (port_value) holds the logic values read from the port
+ * @return the bus bits carried by the port
+ */
+static uint8 GPIO_busGather(const gpio_bus_t *bus_obj,uint8 port_num,uint8 port_value)
+{
+	/* create a local variable to hold the bus bits */
+	uint8 value = GPIO_PORT_MASK_ALL_CLEAR;
+	/* create a local variable to traverse the (bus bit , port pin) pairs of the port */
+	uint8 l_pair = ZERO_INIT;
+	/* get the distance between the bus bits and the port pins */
+	sint8 l_shift = bus_obj->shift[port_num];
+
+	/* keep only the port pins used by the bus */
+	port_value &= bus_obj->port_mask[port_num];
+
+	if(l_shift == GPIO_BUS_NO_SHIFT)
+	{
+		/* move the port pins of this port one by one to their bus bits */
+		for(l_pair = bus_obj->plan_first[port_num]; l_pair < bus_obj->plan_first[port_num + 1]; l_pair++)
+		{
+			if( BIT_IS_SET(port_value,GPIO_BUS_PLAN_PIN(bus_obj->plan[l_pair])) )
+			{
+				SET_BIT(value,GPIO_BUS_PLAN_BIT(bus_obj->plan[l_pair]));
+			}
+			else{ /* Nothing */ }
+		}
+	}
+	else if(l_shift >= 0)
+	{
+		/* all the port pins are moved to their bus bits by one shift */
+		value = (uint8)(port_value >> l_shift);
+	}
+	else
+	{
+		/* all the port pins are moved to their bus bits by one shift */
+		value = (uint8)(port_value << (-l_shift));
+	}
+
+	return value;
 }
 
 
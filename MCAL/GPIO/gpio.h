@@ -15,6 +15,7 @@
 /* ----------------------------------------------------------------------------------- */
 /* ------------------Includes section------------------- */
 #include "ATmega32.h"
+#include "common_macros.h"
 
 
 /* ----------------------------------------------------------------------------------- */
@@ -52,6 +53,83 @@
 #define PIN_MAX                 	8
 #define PORT_MAX                	4
 
+/* maximum number of pins in a gpio bus >> @ref : gpio_bus_t */
+#define GPIO_BUS_MAX_SIZE			8
+
+/* the bus bits of the port don't have the same distance to their port pins so they are scattered bit by bit */
+#define GPIO_BUS_NO_SHIFT			0x7F
+
+/* number of bits of a port in the 32-bit input vector >> @ref : GPIO_readAllPorts */
+#define GPIO_PORT_BITS				8
+
+/* distance between the registers of two successive ports (PORTA 0x3B, PORTB 0x38, PORTC 0x35, PORTD 0x32) */
+#define GPIO_PORT_REGISTERS_OFFSET	3
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+/*
+ * GPIO fast path :
+ * 	- used when the port ID and the pin number are compile-time constants >> @ref : gpio port index / gpio pin index
+ * 	- no validation is done, the user is responsible for passing a valid port ID and pin number
+ * 	- the register address is folded at compile time so each macro is compiled to one bit instruction
+ * 	  (sbi/cbi for write and direction, sbis/sbic for read)
+ * 	- for pins selected at run time use the GPIO APIs (GPIO_setupPinDirection, GPIO_writePin, GPIO_readPin)
+ */
+
+/* --------------------------------- */
+/* registers of the port computed from the port ID */
+
+#define GPIO_PORT_REG(PORT)					IO_REG8( PORTA_ADDRESS - ( GPIO_PORT_REGISTERS_OFFSET * (PORT) ) )
+#define GPIO_DDR_REG(PORT)					IO_REG8( DDRA_ADDRESS  - ( GPIO_PORT_REGISTERS_OFFSET * (PORT) ) )
+#define GPIO_PIN_REG(PORT)					IO_REG8( PINA_ADDRESS  - ( GPIO_PORT_REGISTERS_OFFSET * (PORT) ) )
+
+/* --------------------------------- */
+/* pin direction */
+
+/* set the pin to be output */
+#define GPIO_SET_OUTPUT(PORT,PIN)			SET_BIT( GPIO_DDR_REG(PORT) , (PIN) )
+/* set the pin to be input (the internal pull up resistance is controlled by writing HIGH/LOW on the pin) */
+#define GPIO_SET_INPUT(PORT,PIN)			CLEAR_BIT( GPIO_DDR_REG(PORT) , (PIN) )
+
+/* --------------------------------- */
+/* pin logic */
+
+/* write logic 1 on the pin */
+#define GPIO_SET(PORT,PIN)					SET_BIT( GPIO_PORT_REG(PORT) , (PIN) )
+/* write logic 0 on the pin */
+#define GPIO_CLEAR(PORT,PIN)				CLEAR_BIT( GPIO_PORT_REG(PORT) , (PIN) )
+/* toggle the logic of the pin */
+#define GPIO_TOGGLE(PORT,PIN)				TOGGLE_BIT( GPIO_PORT_REG(PORT) , (PIN) )
+/* write logic HIGH/LOW on the pin */
+#define GPIO_WRITE(PORT,PIN,LOGIC)			( (LOGIC) ? GPIO_SET(PORT,PIN) : GPIO_CLEAR(PORT,PIN) )
+/* read logic HIGH/LOW from the pin */
+#define GPIO_READ(PORT,PIN)					( BIT_IS_SET( GPIO_PIN_REG(PORT) , (PIN) ) ? GPIO_HIGH : GPIO_LOW )
+
+/* --------------------------------- */
+
+/*
+ * 32-bit input vector >> @ref : GPIO_readAllPorts :
+ * 	- pin (x) of port (y) is bit (8 * y + x) (PINA is the least significant byte)
+ * 	- the helpers compare many inputs in one word operation
+ */
+
+/* bit of a pin in the input vector */
+#define GPIO_INPUT_MASK(PORT,PIN)					( (uint32)1 << ( (GPIO_PORT_BITS * (PORT)) + (PIN) ) )
+/* all the pins of the mask have the logic of the same bits of the value */
+#define GPIO_INPUTS_MATCH(INPUTS,MASK,VALUE)		( ( (INPUTS) & (MASK) ) == ( (VALUE) & (MASK) ) )
+/* all the pins of the mask are HIGH */
+#define GPIO_INPUTS_ALL_HIGH(INPUTS,MASK)			( ( (INPUTS) & (MASK) ) == (MASK) )
+/* at least one pin of the mask is HIGH */
+#define GPIO_INPUTS_ANY_HIGH(INPUTS,MASK)			( ( (INPUTS) & (MASK) ) != 0 )
+/* all the pins of the mask are LOW */
+#define GPIO_INPUTS_ALL_LOW(INPUTS,MASK)			( ( (INPUTS) & (MASK) ) == 0 )
+/* pins of the mask which changed between two input vectors */
+#define GPIO_INPUTS_CHANGED(OLD,NEW,MASK)			( ( (OLD) ^ (NEW) ) & (MASK) )
+
+/* --------------------------------- */
+
 
 /* ----------------------------------------------------------------------------------- */
 /* -----user_defined data type declaration section------ */
@@ -69,6 +147,59 @@ typedef struct{
 }gpio_config_t;
 
 
+/*
+ * gpio bus (pin group) structure :
+ * 	- describes up to GPIO_BUS_MAX_SIZE pins which may be spread across the ports
+ * 	- bit (i) of the bus value is carried by pins[i]
+ * 	- GPIO_busInit computes the bit-scatter plan (port_mask, bus_mask, shift, plan) once, so GPIO_busWrite and GPIO_busRead
+ * 	  touch every used port register only once and a port with no shift moves only its own bus bits
+ */
+typedef struct{
+	/* holds the information of the bus pins >> @ref : gpio_config_t */
+	gpio_config_t pins[GPIO_BUS_MAX_SIZE];
+	/* holds the number of the pins used in the bus >> @ref : GPIO_BUS_MAX_SIZE */
+	uint8 size;
+
+	/* ------- bit-scatter plan computed by GPIO_busInit (not set by the user) ------- */
+	/* holds the pins used by the bus in every port */
+	uint8 port_mask[PORT_MAX];
+	/* holds the bus bits carried by every port */
+	uint8 bus_mask[PORT_MAX];
+	/* holds the distance (port pin - bus bit) of every port if it's the same for all of its bus bits >> @ref : GPIO_BUS_NO_SHIFT */
+	sint8 shift[PORT_MAX];
+	/* holds the (bus bit , port pin) pairs of the bus grouped port by port (bus bit >> high nibble , port pin >> low nibble) */
+	uint8 plan[GPIO_BUS_MAX_SIZE];
+	/* holds the index of the first pair of every port in plan (plan_first[PORT_MAX] >> number of pairs) */
+	uint8 plan_first[PORT_MAX + 1];
+}gpio_bus_t;
+
+
+/* gpio port registers map structure */
+typedef struct{
+	/* holds the data memory address of the Data Register (PORTx) */
+	uint8 port_address;
+	/* holds the data memory address of the Data Direction Register (DDRx) */
+	uint8 ddr_address;
+	/* holds the data memory address of the Input Pins Register (PINx) */
+	uint8 pin_address;
+}gpio_port_registers_t;
+
+
+/*
+ * gpio pin handle (validated pin) :
+ * 	- built once by GPIO_pinHandleInit from a gpio_config_t which is checked at that time
+ * 	- holds the registers addresses and the mask of the pin so the Fast APIs do no checks and no table look up
+ */
+typedef struct{
+	/* holds the data memory address of the Data Register (PORTx) */
+	uint8 port_address;
+	/* holds the data memory address of the Input Pins Register (PINx) */
+	uint8 pin_address;
+	/* holds the mask of the pin (1 << pin) */
+	uint8 mask;
+}gpio_pin_handle_t;
+
+
 /* gpio mode select */
 typedef enum{
 	GPIO_MODE_OUTPUT = 0,
@@ -94,6 +225,18 @@ typedef enum{
 Std_ReturnType GPIO_setupPinDirection(gpio_config_t *gpio_obj);
 
 
+/**
+ * @brief  initialize the direction of a table of pins (same modes as GPIO_setupPinDirection)
+ * 			the table is folded into one DDR image and one PORT image per port then every used register is written once
+ * @param  (pins_table) pointer to the first gpio pin object of the table
+ * @param  (pins_num)   holds the number of the pins in the table
+ * @return (l_status)   status of the performed operation
+ *              (E_NOT_OK)  operation failed (nothing is written)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType GPIO_setupPinsFromTable(const gpio_config_t *pins_table,uint8 pins_num);
+
+
 /**
  * @brief  write logic HIGH/LOW on a specific pin
  * @param  (gpio_obj) pointer to the gpio pin object passed by reference
@@ -115,6 +258,45 @@ Std_ReturnType GPIO_writePin(gpio_config_t *gpio_obj,uint8 logic);
 uint8 GPIO_readPin(gpio_config_t *gpio_obj);
 
 
+/**
+ * @brief  validate a pin object once and build its handle for the Fast APIs
+ * @param  (gpio_obj)   pointer to the gpio pin object passed by reference
+ * @param  (pin_handle) pointer to the handle to be built
+ * @return (l_status)   status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType GPIO_pinHandleInit(const gpio_config_t *gpio_obj,gpio_pin_handle_t *pin_handle);
+
+
+/**
+ * @brief  write logic HIGH/LOW on a pin through its handle
+ * 			NOTE: no checks are done, the handle must be built by GPIO_pinHandleInit
+ * @param  (pin_handle) pointer to the pin handle
+ * @param  (logic)      holds the logic value (HIGH/LOW) to be written on the pin
+ */
+void GPIO_writePinFast(const gpio_pin_handle_t *pin_handle,uint8 logic);
+
+
+/**
+ * @brief  toggle the logic of a pin through its handle
+ * 			NOTE: no checks are done, the handle must be built by GPIO_pinHandleInit
+ * @param  (pin_handle) pointer to the pin handle
+ */
+void GPIO_togglePinFast(const gpio_pin_handle_t *pin_handle);
+
+
+/**
+ * @brief  read logic from a pin through its handle
+ * 			NOTE: no checks are done, the handle must be built by GPIO_pinHandleInit
+ * @param  (pin_handle) pointer to the pin handle
+ * @return (logic)      the logic status of the pin
+ *              (GPIO_LOW)  	read logic 0
+ *              (GPIO_HIGH)		read logic 1
+ */
+uint8 GPIO_readPinFast(const gpio_pin_handle_t *pin_handle);
+
+
 /**
  * @brief  initialize the direction of the port to be one of the following modes :
  *				1- Output mode
@@ -149,5 +331,83 @@ Std_ReturnType GPIO_writePort(uint8 port_num,uint8 logic);
 uint8 GPIO_readPort(uint8 port_num);
 
 
+/**
+ * @brief  read the logic of all the ports sampled back-to-back
+ * @return 32-bit input vector (PINA is the least significant byte, pin (x) of port (y) is bit (8 * y + x))
+ */
+uint32 GPIO_readAllPorts(void);
+
+
+/**
+ * @brief  write logic HIGH/LOW on the pins of a specific port selected by a mask without changing the other pins
+ * 			(one interrupt safe read-modify-write on the port)
+ * @param  (port_num) holds the ID of the port to be set
+ * @param  (mask)     holds the pins to be written (bit = 1 >> pin is written, bit = 0 >> pin is not changed)
+ * @param  (logic)    holds the logic values (HIGH/LOW) to be written on the selected pins
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType GPIO_writePortMasked(uint8 port_num,uint8 mask,uint8 logic);
+
+
+/**
+ * @brief  write logic HIGH on the pins of a specific port selected by a mask without changing the other pins
+ * 			(one interrupt safe read-modify-write on the port)
+ * @param  (port_num) holds the ID of the port to be set
+ * @param  (mask)     holds the pins to be set (bit = 1 >> pin is set, bit = 0 >> pin is not changed)
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType GPIO_setPortBits(uint8 port_num,uint8 mask);
+
+
+/**
+ * @brief  write logic LOW on the pins of a specific port selected by a mask without changing the other pins
+ * 			(one interrupt safe read-modify-write on the port)
+ * @param  (port_num) holds the ID of the port to be set
+ * @param  (mask)     holds the pins to be cleared (bit = 1 >> pin is cleared, bit = 0 >> pin is not changed)
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType GPIO_clearPortBits(uint8 port_num,uint8 mask);
+
+
+/**
+ * @brief  initialize the gpio bus :
+ * 				1- Setup the direction of every pin of the bus
+ * 				2- Compute the bit-scatter plan of the bus (pins mask, bus bits, shift and (bus bit , port pin) pairs of every port)
+ * @param  (bus_obj)  pointer to the gpio bus object passed by reference
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType GPIO_busInit(gpio_bus_t *bus_obj);
+
+
+/**
+ * @brief  write a value on the gpio bus (bit (i) of the value is written on pins[i])
+ * 			every used port is written once through GPIO_writePortMasked
+ * @param  (bus_obj)  pointer to the gpio bus object initialized by GPIO_busInit
+ * @param  (value)    holds the value to be written on the bus
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType GPIO_busWrite(const gpio_bus_t *bus_obj,uint8 value);
+
+
+/**
+ * @brief  read a value from the gpio bus (bit (i) of the value is read from pins[i])
+ * 			every used port is read once
+ * @param  (bus_obj)  pointer to the gpio bus object initialized by GPIO_busInit
+ * @return (value)    the value read from the bus
+ *              (GPIO_PORT_MASK_ALL_CLEAR)  	if NULL pointer is passed
+ */
+uint8 GPIO_busRead(const gpio_bus_t *bus_obj);
+
+
 /* ----------------------------------------------------------------------------------- */
 #endif /* _GPIO_H_ */
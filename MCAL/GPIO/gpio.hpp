@@ -0,0 +1,258 @@
+/*
+ =========================================================================================
+ Name        : gpio.hpp
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : GPIO C++ Template Layer Header file (header only, C++11)
+ =========================================================================================
+*/
+
+#ifndef _GPIO_HPP_
+#define _GPIO_HPP_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+extern "C" {
+#include "gpio.h"
+}
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * GPIO C++ Template Layer :
+ * 	- the port ID and the pin number are template parameters so every access is folded to the GPIO fast path
+ * 	  (one sbi/cbi/sbis/sbic instruction per pin, no object, no RAM)
+ * 	- a PinGroup merges its pins by port at compile time, writing the group is one masked write per used port
+ * 	- every class has only static members so a driver takes the pins as template parameters :
+ *
+ * 		typedef gpio::OutputPin<GPIO_PORTB,GPIO_PIN0> LcdRs;
+ * 		typedef gpio::PinGroup< gpio::OutputPin<GPIO_PORTA,GPIO_PIN4> , gpio::OutputPin<GPIO_PORTA,GPIO_PIN5> ,
+ * 								gpio::OutputPin<GPIO_PORTA,GPIO_PIN6> , gpio::OutputPin<GPIO_PORTA,GPIO_PIN7> > LcdData;
+ *
+ * 		template <class RS , class DATA> void lcdSendNibble(uint8 nibble) { RS::set(); DATA::write(nibble); }
+ *
+ * 	- the LCD and keypad drivers take them this way >> @ref : HAL/LCD/lcd.hpp , HAL/KEYPAD/keypad.hpp
+ */
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -----user_defined data type declaration section------ */
+
+namespace gpio
+{
+
+/* --------------------------------- */
+/* output pin */
+
+template <uint8 PORT , uint8 PIN>
+struct OutputPin
+{
+	static_assert(PORT < PORT_MAX , "port number is higher than the maximum number of ports");
+	static_assert(PIN < PIN_MAX , "pin number is higher than the maximum number of pins");
+
+	/* port ID, pin number and mask of the pin */
+	static const uint8 port = PORT;
+	static const uint8 pin = PIN;
+	static const uint8 mask = (uint8)(1 << PIN);
+
+	/* set the pin to be output */
+	static void init(void) { GPIO_SET_OUTPUT(PORT,PIN); }
+
+	/* write logic 1/0 on the pin */
+	static void set(void) { GPIO_SET(PORT,PIN); }
+	static void clear(void) { GPIO_CLEAR(PORT,PIN); }
+	/* toggle the logic of the pin */
+	static void toggle(void) { GPIO_TOGGLE(PORT,PIN); }
+	/* write logic HIGH/LOW on the pin */
+	static void write(uint8 logic) { GPIO_WRITE(PORT,PIN,logic); }
+	/* read logic HIGH/LOW from the pin */
+	static uint8 read(void) { return GPIO_READ(PORT,PIN); }
+};
+
+/* --------------------------------- */
+/* input pin */
+
+template <uint8 PORT , uint8 PIN , bool PULL_UP = false>
+struct InputPin
+{
+	static_assert(PORT < PORT_MAX , "port number is higher than the maximum number of ports");
+	static_assert(PIN < PIN_MAX , "pin number is higher than the maximum number of pins");
+
+	/* port ID, pin number and mask of the pin */
+	static const uint8 port = PORT;
+	static const uint8 pin = PIN;
+	static const uint8 mask = (uint8)(1 << PIN);
+
+	/* set the pin to be input with/without internal pull up resistance */
+	static void init(void)
+	{
+		GPIO_SET_INPUT(PORT,PIN);
+		if(PULL_UP)
+		{
+			GPIO_SET(PORT,PIN);
+		}
+		else
+		{
+			GPIO_CLEAR(PORT,PIN);
+		}
+	}
+
+	/* read logic HIGH/LOW from the pin */
+	static uint8 read(void) { return GPIO_READ(PORT,PIN); }
+	static bool isHigh(void) { return BIT_IS_SET( GPIO_PIN_REG(PORT) , PIN ) != 0; }
+	static bool isLow(void) { return BIT_IS_CLEARED( GPIO_PIN_REG(PORT) , PIN ); }
+};
+
+/* --------------------------------- */
+/* compile-time helpers of PinGroup (bit (i) of the group value is carried by the pin (i) of the list) */
+
+namespace detail
+{
+
+/* pins of the list which belong to the port */
+template <uint8 PORT , class... PINS>
+struct PortMask
+{
+	static const uint8 value = 0;
+};
+
+template <uint8 PORT , class FIRST , class... REST>
+struct PortMask<PORT , FIRST , REST...>
+{
+	static const uint8 value = (uint8)( ( (FIRST::port == PORT) ? FIRST::mask : 0 ) | PortMask<PORT , REST...>::value );
+};
+
+/* scatter the group value to the image of the port */
+template <uint8 PORT , uint8 INDEX , class... PINS>
+struct PortScatter
+{
+	static uint8 image(uint8) { return 0; }
+};
+
+template <uint8 PORT , uint8 INDEX , class FIRST , class... REST>
+struct PortScatter<PORT , INDEX , FIRST , REST...>
+{
+	static uint8 image(uint8 value)
+	{
+		return (uint8)( ( ( (FIRST::port == PORT) && (value & (1 << INDEX)) ) ? FIRST::mask : 0 ) |
+						PortScatter<PORT , INDEX + 1 , REST...>::image(value) );
+	}
+};
+
+/* gather the group value from the PINx Registers images */
+template <uint8 INDEX , class... PINS>
+struct Gather
+{
+	static uint8 value(const uint8 *) { return 0; }
+};
+
+template <uint8 INDEX , class FIRST , class... REST>
+struct Gather<INDEX , FIRST , REST...>
+{
+	static uint8 value(const uint8 *pins)
+	{
+		return (uint8)( ( (pins[FIRST::port] & FIRST::mask) ? (1 << INDEX) : 0 ) | Gather<INDEX + 1 , REST...>::value(pins) );
+	}
+};
+
+/* pin (INDEX) of the list */
+template <uint8 INDEX , class FIRST , class... REST>
+struct PinAt
+{
+	typedef typename PinAt<INDEX - 1 , REST...>::type type;
+};
+
+template <class FIRST , class... REST>
+struct PinAt<0 , FIRST , REST...>
+{
+	typedef FIRST type;
+};
+
+/* init every pin of the list */
+template <class... PINS>
+struct InitAll
+{
+	static void init(void) { }
+};
+
+template <class FIRST , class... REST>
+struct InitAll<FIRST , REST...>
+{
+	static void init(void) { FIRST::init(); InitAll<REST...>::init(); }
+};
+
+} /* namespace detail */
+
+/* --------------------------------- */
+/* pin group (up to GPIO_BUS_MAX_SIZE pins on any ports) */
+
+template <class... PINS>
+struct PinGroup
+{
+	static_assert(sizeof...(PINS) <= GPIO_BUS_MAX_SIZE , "number of pins is higher than the maximum size of a gpio bus");
+
+	/* number of pins of the group */
+	static const uint8 size = sizeof...(PINS);
+
+	/* pin (INDEX) of the group (carries bit (INDEX) of the group value) */
+	template <uint8 INDEX>
+	using pin = typename detail::PinAt<INDEX , PINS...>::type;
+
+	/* pins of the group in every port */
+	static const uint8 mask_a = detail::PortMask<GPIO_PORTA , PINS...>::value;
+	static const uint8 mask_b = detail::PortMask<GPIO_PORTB , PINS...>::value;
+	static const uint8 mask_c = detail::PortMask<GPIO_PORTC , PINS...>::value;
+	static const uint8 mask_d = detail::PortMask<GPIO_PORTD , PINS...>::value;
+
+	/* init every pin of the group */
+	static void init(void) { detail::InitAll<PINS...>::init(); }
+
+	/* write the group value, one masked write per used port (interrupt safe as GPIO_writePortMasked) */
+	static void write(uint8 value)
+	{
+		/* create a local variable to hold the Status Register */
+		uint8 l_sreg = ZERO_INIT;
+
+		CRITICAL_SECTION_ENTER(l_sreg);
+		writePort<GPIO_PORTA , mask_a>(value);
+		writePort<GPIO_PORTB , mask_b>(value);
+		writePort<GPIO_PORTC , mask_c>(value);
+		writePort<GPIO_PORTD , mask_d>(value);
+		CRITICAL_SECTION_EXIT(l_sreg);
+	}
+
+	/* read the group value, every used PINx Register is read once */
+	static uint8 read(void)
+	{
+		/* create a local array to hold the PINx Registers images */
+		uint8 l_pins[PORT_MAX] = { 0 };
+
+		if(mask_a) { l_pins[GPIO_PORTA] = GPIO_PIN_REG(GPIO_PORTA); }
+		if(mask_b) { l_pins[GPIO_PORTB] = GPIO_PIN_REG(GPIO_PORTB); }
+		if(mask_c) { l_pins[GPIO_PORTC] = GPIO_PIN_REG(GPIO_PORTC); }
+		if(mask_d) { l_pins[GPIO_PORTD] = GPIO_PIN_REG(GPIO_PORTD); }
+
+		return detail::Gather<0 , PINS...>::value(l_pins);
+	}
+
+private:
+	/* masked write of one port, removed at compile time if the group has no pins in the port */
+	template <uint8 PORT , uint8 MASK>
+	static void writePort(uint8 value)
+	{
+		if(MASK)
+		{
+			GPIO_PORT_REG(PORT) = (uint8)( ( GPIO_PORT_REG(PORT) & (uint8)(~MASK) ) | detail::PortScatter<PORT , 0 , PINS...>::image(value) );
+		}
+	}
+};
+
+} /* namespace gpio */
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _GPIO_HPP_ */
@@ -235,19 +235,19 @@ void I2C_setBitRate(uint32 i2c_speed)
 	switch(_TWSR._TWPSx)
 	{
 		case I2C_CLOCK_SOURCE_DIV_1		:	/* Prescaler Value = 1 */
-											_TWBR.Byte = (uint8)( ( ( (CPU_FREQUENCY) / (i2c_speed) ) - 16 ) / (2.0 * 1) );
+											_TWBR.Byte = TIMING_TWBR(i2c_speed,I2C_CLOCK_SOURCE_DIV_1);
 											break;
 
 		case I2C_CLOCK_SOURCE_DIV_4		:	/* Prescaler Value = 4 */
-											_TWBR.Byte = (uint8)( ( ( (CPU_FREQUENCY) / (i2c_speed) ) - 16 ) / (2.0 * 4) );
+											_TWBR.Byte = TIMING_TWBR(i2c_speed,I2C_CLOCK_SOURCE_DIV_4);
 											break;
 
 		case I2C_CLOCK_SOURCE_DIV_16	:	/* Prescaler Value = 16 */
-											_TWBR.Byte = (uint8)( ( ( (CPU_FREQUENCY) / (i2c_speed) ) - 16 ) / (2.0 * 16) );
+											_TWBR.Byte = TIMING_TWBR(i2c_speed,I2C_CLOCK_SOURCE_DIV_16);
 											break;
 
 		case I2C_CLOCK_SOURCE_DIV_64	:	/* Prescaler Value = 64 */
-											_TWBR.Byte = (uint8)( ( ( (CPU_FREQUENCY) / (i2c_speed) ) - 16 ) / (2.0 * 64) );
+											_TWBR.Byte = TIMING_TWBR(i2c_speed,I2C_CLOCK_SOURCE_DIV_64);
 											break;
 
 		default	:	/* Nothing */
@@ -25,6 +25,23 @@
 static void (* SPI_InterruptHandler)(void) = NULL_PTR;
 
 
+/* SPI pins configurations in Master Mode */
+static const gpio_config_t spi_master_pins[] = {
+		{ SPI_MOSI_PORT_INDEX , SPI_MOSI_PIN_INDEX , GPIO_MODE_OUTPUT },								/* MOSI >> Output */
+		{ SPI_MISO_PORT_INDEX , SPI_MISO_PIN_INDEX , GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES },	/* MISO >> Input */
+		{ SPI_SCK_PORT_INDEX  , SPI_SCK_PIN_INDEX  , GPIO_MODE_OUTPUT },								/* SCK  >> Output */
+		{ SPI_SS_PORT_INDEX   , SPI_SS_PIN_INDEX   , SPI_SS_MASTER_MODE }								/* SS   >> Output/Input */
+};
+
+/* SPI pins configurations in Slave Mode */
+static const gpio_config_t spi_slave_pins[] = {
+		{ SPI_MOSI_PORT_INDEX , SPI_MOSI_PIN_INDEX , GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES },	/* MOSI >> Input */
+		{ SPI_MISO_PORT_INDEX , SPI_MISO_PIN_INDEX , GPIO_MODE_OUTPUT },								/* MISO >> Output */
+		{ SPI_SCK_PORT_INDEX  , SPI_SCK_PIN_INDEX  , GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES },	/* SCK  >> Input */
+		{ SPI_SS_PORT_INDEX   , SPI_SS_PIN_INDEX   , GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES }	/* SS   >> Input */
+};
+
+
 /* ----------------------------------------------------------------------------------- */
 /* ------------functions declaration section------------ */
 
@@ -85,6 +102,10 @@ Std_ReturnType SPI_init(spi_config_t *spi_obj)
 	/* create a local variable to hold the status of the performed operation */
 	Std_ReturnType l_status = ZERO_INIT;
 
+	/* create local variables to hold the images of the SPI Control and Status Registers */
+	SPCR_CFG_t l_spcr = { .Byte = ZERO_INIT };
+	SPSR_CFG_t l_spsr = { .Byte = ZERO_INIT };
+
 	/* check if the address is valid or not */
 	if(spi_obj == NULL_PTR)
 	{
@@ -100,9 +121,11 @@ Std_ReturnType SPI_init(spi_config_t *spi_obj)
 
 		/* SPI Init */
 
+		/* the SPCR and SPSR images are built in local variables then every Register is written once */
+
 		/* --------------------------------- */
 		/* 1- Select SPI Mode(Master/Slave) */
-		_SPCR._MSTR = spi_obj->mode_select;
+		l_spcr._MSTR = spi_obj->mode_select;
 		/* --------------------------------- */
 
 		/* --------------------------------- */
@@ -115,32 +138,32 @@ Std_ReturnType SPI_init(spi_config_t *spi_obj)
 
 		switch(spi_obj->clk_rate)
 		{
-			case SPI_CLOCK_SOURCE_DIV_4			:	_SPSR._SPI2X = RESET; _SPCR._SPR1 = RESET; _SPCR._SPR0 = RESET; break;
-			case SPI_CLOCK_SOURCE_DIV_16		:	_SPSR._SPI2X = RESET; _SPCR._SPR1 = RESET; _SPCR._SPR0 = SET; 	break;
-			case SPI_CLOCK_SOURCE_DIV_64		:	_SPSR._SPI2X = RESET; _SPCR._SPR1 = SET;   _SPCR._SPR0 = RESET; break;
-			case SPI_CLOCK_SOURCE_DIV_128		:	_SPSR._SPI2X = RESET; _SPCR._SPR1 = SET;   _SPCR._SPR0 = SET;   break;
-			case SPI_DOUBLE_CLOCK_SOURCE_DIV_2	:	_SPSR._SPI2X = SET;   _SPCR._SPR1 = RESET; _SPCR._SPR0 = RESET; break;
-			case SPI_DOUBLE_CLOCK_SOURCE_DIV_8	:	_SPSR._SPI2X = SET;   _SPCR._SPR1 = RESET; _SPCR._SPR0 = SET;   break;
-			case SPI_DOUBLE_CLOCK_SOURCE_DIV_32	:	_SPSR._SPI2X = SET;   _SPCR._SPR1 = SET;   _SPCR._SPR0 = RESET; break;
-			case SPI_DOUBLE_CLOCK_SOURCE_DIV_64	:	_SPSR._SPI2X = SET;   _SPCR._SPR1 = SET;   _SPCR._SPR0 = SET;   break;
+			case SPI_CLOCK_SOURCE_DIV_4			:	l_spsr._SPI2X = RESET; l_spcr._SPR1 = RESET; l_spcr._SPR0 = RESET; break;
+			case SPI_CLOCK_SOURCE_DIV_16		:	l_spsr._SPI2X = RESET; l_spcr._SPR1 = RESET; l_spcr._SPR0 = SET; 	break;
+			case SPI_CLOCK_SOURCE_DIV_64		:	l_spsr._SPI2X = RESET; l_spcr._SPR1 = SET;   l_spcr._SPR0 = RESET; break;
+			case SPI_CLOCK_SOURCE_DIV_128		:	l_spsr._SPI2X = RESET; l_spcr._SPR1 = SET;   l_spcr._SPR0 = SET;   break;
+			case SPI_DOUBLE_CLOCK_SOURCE_DIV_2	:	l_spsr._SPI2X = SET;   l_spcr._SPR1 = RESET; l_spcr._SPR0 = RESET; break;
+			case SPI_DOUBLE_CLOCK_SOURCE_DIV_8	:	l_spsr._SPI2X = SET;   l_spcr._SPR1 = RESET; l_spcr._SPR0 = SET;   break;
+			case SPI_DOUBLE_CLOCK_SOURCE_DIV_32	:	l_spsr._SPI2X = SET;   l_spcr._SPR1 = SET;   l_spcr._SPR0 = RESET; break;
+			case SPI_DOUBLE_CLOCK_SOURCE_DIV_64	:	l_spsr._SPI2X = SET;   l_spcr._SPR1 = SET;   l_spcr._SPR0 = SET;   break;
 			default 	:	/* Nothing */	break;
 		}
 		/* --------------------------------- */
 
 		/* --------------------------------- */
 		/* 4- Select Data Order */
-		_SPCR._DORD = spi_obj->data_order;
+		l_spcr._DORD = spi_obj->data_order;
 
 		/* 5- Select Clock Polarity */
-		_SPCR._CPOL = spi_obj->clk_polarity;
+		l_spcr._CPOL = spi_obj->clk_polarity;
 
 		/* 6- Select Clock Phase */
-		_SPCR._CPHA = spi_obj->clk_phase;
+		l_spcr._CPHA = spi_obj->clk_phase;
 		/* --------------------------------- */
 
 		/* --------------------------------- */
 		/* 7- Enable/Disable SPI Interrupt */
-		_SPCR._SPIE = spi_obj->interrupt_en;
+		l_spcr._SPIE = spi_obj->interrupt_en;
 
 		/* 8- Set SPI Transfer Complete Call Back if it's interrupt is enabled */
 		if(spi_obj->interrupt_en == SPI_INTERRUPT_DISABLE)
@@ -158,7 +181,11 @@ Std_ReturnType SPI_init(spi_config_t *spi_obj)
 
 		/* --------------------------------- */
 		/* Enable SPI */
-		SPI_ENABLE();
+		l_spcr._SPE = SET;
+
+		/* SPI2X is the only writable bit of SPSR, then SPCR enables the SPI with its configuration */
+		_SPSR.Byte = l_spsr.Byte;
+		_SPCR.Byte = l_spcr.Byte;
 		/* --------------------------------- */
 	}
 
@@ -187,8 +214,9 @@ void SPI_sendByte(uint8 data)
 	 *  then accessing the SPI Data Register (SPDR)
 	 */
 
-	/* Dummy Read */
+	/* Dummy Read (only clears SPIF, the byte isn't used) */
 	dummy_byte = _SPDR.Byte;
+	(void)dummy_byte;
 }
 
 
@@ -346,73 +374,20 @@ static Std_ReturnType SPI_GPIO_pinSetup(uint8 spi_mode)
 	/* create a local variable to hold the status of the performed operation */
 	Std_ReturnType l_status = E_OK;
 
-	/* create a local object of type gpio_config_t to hold the configurations of SPI pins */
-	gpio_config_t spi_pin_obj;
-
 	/* check if SPI is in Master/Slave Mode */
 	if(spi_mode == SPI_MODE_MASTER_SELECT)
 	{
 		/* SPI Master Mode Selected */
 
-		/* MOSI >> Output */
-		spi_pin_obj.port = SPI_MOSI_PORT_INDEX;
-		spi_pin_obj.pin = SPI_MOSI_PIN_INDEX;
-		spi_pin_obj.mode = GPIO_MODE_OUTPUT;
-
-		l_status |= GPIO_setupPinDirection(&spi_pin_obj);
-
-		/* MISO >> Input */
-		spi_pin_obj.port = SPI_MISO_PORT_INDEX;
-		spi_pin_obj.pin = SPI_MISO_PIN_INDEX;
-		spi_pin_obj.mode = GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES;
-
-		l_status |= GPIO_setupPinDirection(&spi_pin_obj);
-
-		/* SCK  >> Output */
-		spi_pin_obj.port = SPI_SCK_PORT_INDEX;
-		spi_pin_obj.pin = SPI_SCK_PIN_INDEX;
-		spi_pin_obj.mode = GPIO_MODE_OUTPUT;
-
-		l_status |= GPIO_setupPinDirection(&spi_pin_obj);
-
-		/* SS   >> Output/Input */
-		spi_pin_obj.port = SPI_SS_PORT_INDEX;
-		spi_pin_obj.pin = SPI_SS_PIN_INDEX;
-		spi_pin_obj.mode = SPI_SS_MASTER_MODE;
-
-		l_status |= GPIO_setupPinDirection(&spi_pin_obj);
+		/* setup all the SPI pins in one step */
+		l_status = GPIO_setupPinsFromTable( spi_master_pins , (sizeof(spi_master_pins) / sizeof(spi_master_pins[0])) );
 	}
 	else if(spi_mode == SPI_MODE_SLAVE_SELECT)
 	{
 		/* SPI Slave Mode Selected */
 
-		/* MOSI >> Input */
-		spi_pin_obj.port = SPI_MOSI_PORT_INDEX;
-		spi_pin_obj.pin = SPI_MOSI_PIN_INDEX;
-		spi_pin_obj.mode = GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES;
-
-		l_status |= GPIO_setupPinDirection(&spi_pin_obj);
-
-		/* MISO >> Output */
-		spi_pin_obj.port = SPI_MISO_PORT_INDEX;
-		spi_pin_obj.pin = SPI_MISO_PIN_INDEX;
-		spi_pin_obj.mode = GPIO_MODE_OUTPUT;
-
-		l_status |= GPIO_setupPinDirection(&spi_pin_obj);
-
-		/* SCK  >> Input */
-		spi_pin_obj.port = SPI_SCK_PORT_INDEX;
-		spi_pin_obj.pin = SPI_SCK_PIN_INDEX;
-		spi_pin_obj.mode = GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES;
-
-		l_status |= GPIO_setupPinDirection(&spi_pin_obj);
-
-		/* SS   >> Input */
-		spi_pin_obj.port = SPI_SS_PORT_INDEX;
-		spi_pin_obj.pin = SPI_SS_PIN_INDEX;
-		spi_pin_obj.mode = GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES;
-
-		l_status |= GPIO_setupPinDirection(&spi_pin_obj);
+		/* setup all the SPI pins in one step */
+		l_status = GPIO_setupPinsFromTable( spi_slave_pins , (sizeof(spi_slave_pins) / sizeof(spi_slave_pins[0])) );
 	}
 	else{ /* Nothing */ }
 
@@ -440,8 +440,8 @@ Std_ReturnType TIMER0_PWM_init(timer0_pwm_config_t *pwm_obj)
  */
 void TIMER0_PWM_Start(uint8 duty_cycle)
 {
-	/* calculate the OCR value according to the duty cycle selected */
-	_OCR0.Byte = (uint8)( (duty_cycle / 100.0) * 255 );
+	/* calculate the OCR value according to the duty cycle selected (duty_cycle * 255 / 100, the scale is a constant) */
+	_OCR0.Byte = (uint8)TIMING_PERCENT_OF( duty_cycle , TIMING_PERCENT_SCALE(255) );
 }
 
 
@@ -193,7 +193,14 @@ void TIMER1_setTimerValue(uint16 timer1_val)
  */
 void TIMER1_ICU_setEdgeDetectionType(icu_edge_select_t icu_edge_type)
 {
+	/* create a local variable to hold the image of TIFR (only the Input Capture Flag is cleared) */
+	TIFR_CFG_t l_tifr = { .Byte = ZERO_INIT };
+
 	_TCCR1B._ICES1 = icu_edge_type;
+
+	/* a change of ICES1 may set the Input Capture Flag, clear it by writing a logic one to its bit location */
+	l_tifr._ICF1 = SET;
+	_TIFR.Byte = l_tifr.Byte;
 }
 
 
@@ -303,6 +310,11 @@ Std_ReturnType TIMER1_CTC_init(timer1_ctc_config_t *timer1_ctc_obj)
 	/* create a local variable to hold the status of the performed operation */
 	Std_ReturnType l_status = ZERO_INIT;
 
+	/* create local variables to hold the images of the TIMER1 Control Registers and the Interrupt Mask Register */
+	TCCR1A_CFG_t l_tccr1a = { .Byte = ZERO_INIT };
+	TCCR1B_CFG_t l_tccr1b = { .Byte = ZERO_INIT };
+	TIMSK_CFG_t l_timsk = { .Byte = ZERO_INIT };
+
 	/* check if the address is valid or not */
 	if(timer1_ctc_obj == NULL_PTR)
 	{
@@ -318,33 +330,38 @@ Std_ReturnType TIMER1_CTC_init(timer1_ctc_config_t *timer1_ctc_obj)
 
 		/* TIMER1 Clear Timer on Compare Match (CTC) Mode Init */
 
+		/* the TCCR1A, TCCR1B and TIMSK images are built in local variables then every Register is written once */
+
 		/* --------------------------------- */
 		/* Non PWM Mode (OverFlow or Output Compare Match) */
-		_TCCR1A._FOC1A = TIMER1_FORCE_OUTPUT_COMPARE_A_ENABLE;
-		_TCCR1A._FOC1B = TIMER1_FORCE_OUTPUT_COMPARE_B_ENABLE;
+		l_tccr1a._FOC1A = TIMER1_FORCE_OUTPUT_COMPARE_A_ENABLE;
+		l_tccr1a._FOC1B = TIMER1_FORCE_OUTPUT_COMPARE_B_ENABLE;
 
 		/* set the TIMER1 Output Compare Match Mode */
 		if(timer1_ctc_obj->mode == TIMER1_CTC_MODE_1)
 		{
 			/* TOP = OCR1A */
-			_TCCR1A._WGM10 = RESET;
-			_TCCR1A._WGM11 = RESET;
-			_TCCR1B._WGM12 = SET;
-			_TCCR1B._WGM13 = RESET;
+			l_tccr1a._WGM10 = RESET;
+			l_tccr1a._WGM11 = RESET;
+			l_tccr1b._WGM12 = SET;
+			l_tccr1b._WGM13 = RESET;
 		}
 		else if(timer1_ctc_obj->mode == TIMER1_CTC_MODE_2)
 		{
 			/* TOP = ICR1 */
-			_TCCR1A._WGM10 = RESET;
-			_TCCR1A._WGM11 = RESET;
-			_TCCR1B._WGM12 = SET;
-			_TCCR1B._WGM13 = SET;
+			l_tccr1a._WGM10 = RESET;
+			l_tccr1a._WGM11 = RESET;
+			l_tccr1b._WGM12 = SET;
+			l_tccr1b._WGM13 = SET;
 		}
 		else{ /* Nothing */ }
 
 		/* control the Output Compare pins (OC1A and OC1B) behavior */
-		_TCCR1A._COM1Ax = timer1_ctc_obj->OC1A_mode;
-		_TCCR1A._COM1Bx = timer1_ctc_obj->OC1B_mode;
+		l_tccr1a._COM1Ax = timer1_ctc_obj->OC1A_mode;
+		l_tccr1a._COM1Bx = timer1_ctc_obj->OC1B_mode;
+
+		/* the waveform generation mode is split between TCCR1A and TCCR1B, TCCR1B is written last with the clock source */
+		_TCCR1A.Byte = l_tccr1a.Byte;
 		/* --------------------------------- */
 
 		/* --------------------------------- */
@@ -390,8 +407,11 @@ Std_ReturnType TIMER1_CTC_init(timer1_ctc_config_t *timer1_ctc_obj)
 		/* --------------------------------- */
 
 		/* --------------------------------- */
+		/* TIMSK is shared with TIMER0 and TIMER2 so its image starts from the Register value */
+		l_timsk.Byte = _TIMSK.Byte;
+
 		/* Enable/Disable Timer/Counter1 Output Compare A Match Interrupt */
-		_TIMSK._OCIE1A = timer1_ctc_obj->ctc_A_interrupt_en;
+		l_timsk._OCIE1A = timer1_ctc_obj->ctc_A_interrupt_en;
 
 		/* Set TIMER1 Output Compare A Match Call Back if Output Compare A Match Interrupt enabled */
 		if(timer1_ctc_obj->ctc_A_interrupt_en == TIMER1_OUTPUT_COMPARE_A_MATCH_INTERRUPT_DISABLE)
@@ -408,7 +428,7 @@ Std_ReturnType TIMER1_CTC_init(timer1_ctc_config_t *timer1_ctc_obj)
 
 
 		/* Enable/Disable Timer/Counter1 Output Compare B Match Interrupt */
-		_TIMSK._OCIE1B = timer1_ctc_obj->ctc_B_interrupt_en;
+		l_timsk._OCIE1B = timer1_ctc_obj->ctc_B_interrupt_en;
 
 		/* Set TIMER1 Output Compare B Match Call Back if Output Compare B Match Interrupt enabled */
 		if(timer1_ctc_obj->ctc_B_interrupt_en == TIMER1_OUTPUT_COMPARE_B_MATCH_INTERRUPT_DISABLE)
@@ -426,7 +446,11 @@ Std_ReturnType TIMER1_CTC_init(timer1_ctc_config_t *timer1_ctc_obj)
 
 		/* --------------------------------- */
 		/* select TIMER1 Clock Source */
-		TIMER1_ENABLE(timer1_ctc_obj->clock_source);
+		l_tccr1b._CS1x = timer1_ctc_obj->clock_source;
+
+		/* the interrupts are enabled after the call backs are set, then TCCR1B starts the timer */
+		_TIMSK.Byte = l_timsk.Byte;
+		_TCCR1B.Byte = l_tccr1b.Byte;
 		/* --------------------------------- */
 	}
 
@@ -711,11 +735,11 @@ void TIMER1_PWM_Start(uint8 duty_cycle)
 	case TIMER1_PHASE_CORRECT_MODE_2				:	/* to do.. */	break;
 
 	case TIMER1_FAST_PWM_MODE_1						:	/* TOP = ICR1 */
-														_OCR1A.TwoBytes = (uint16)( (duty_cycle / 100.0) * _ICR1.TwoBytes );
+														_OCR1A.TwoBytes = (uint16)( ( (uint32)duty_cycle * _ICR1.TwoBytes ) / 100 );
 														break;
 
 	case TIMER1_FAST_PWM_MODE_2						:	/* TOP = OCR1A */
-														_OCR1B.TwoBytes = (uint16)( (duty_cycle / 100.0) * _OCR1A.TwoBytes );
+														_OCR1B.TwoBytes = (uint16)( ( (uint32)duty_cycle * _OCR1A.TwoBytes ) / 100 );
 														break;
 
 	default :	/* Nothing */	break;
@@ -17,6 +17,29 @@
 #include "usart.h"
 
 
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+#if USART_CFG_TX_RING_BUFFER
+/* position of a free running index in the TX ring buffer */
+#define USART_TX_RING_INDEX(INDEX)							( (INDEX) & (USART_TX_RING_BUFFER_SIZE - 1) )
+#endif
+
+#if USART_CFG_TX_DESCRIPTOR_QUEUE
+/* position of a free running index in the TX descriptor queue */
+#define USART_TX_QUEUE_INDEX(INDEX)							( (INDEX) & (USART_TX_DESCRIPTOR_QUEUE_SIZE - 1) )
+#endif
+
+#if USART_CFG_RX_RING_BUFFER
+/* position of a free running index in the RX ring buffer */
+#define USART_RX_RING_INDEX(INDEX)							( (INDEX) & (USART_RX_RING_BUFFER_SIZE - 1) )
+#endif
+
+
+/* the error returned by the BAUD RATE solver is limited to +/- 327.67 % (also returned for 0 baud) */
+#define USART_BAUD_RATE_ERROR_LIMIT							32767
+
+
 /* ----------------------------------------------------------------------------------- */
 /* -------------------Global section-------------------- */
 
@@ -38,6 +61,56 @@ static void (* USART_TX_BufferEmpty_InterruptHandler)(void) = NULL_PTR;
 static void (* USART_TX_Complete_InterruptHandler)(void) = NULL_PTR;
 #endif
 
+#if USART_CFG_TX_RING_BUFFER
+/* UART TX Ring Buffer :
+ 	 the head is moved by UART_write only and the tail by the USART Data Register Empty ISR only,
+ 	 they are free running (head - tail = number of bytes in the ring) and every one is written by a single store */
+static volatile uint8 usart_tx_ring[USART_TX_RING_BUFFER_SIZE];
+static volatile uint8 usart_tx_head = ZERO_INIT;
+static volatile uint8 usart_tx_tail = ZERO_INIT;
+#endif
+
+#if USART_CFG_TX_DESCRIPTOR_QUEUE
+/* UART TX Descriptor Queue :
+ 	 the head is moved by UART_queueTx (interrupts disabled, it may be called from a Done Call Back) and the tail by the ISR only */
+static uart_tx_descriptor_t usart_tx_queue[USART_TX_DESCRIPTOR_QUEUE_SIZE];
+static volatile uint8 usart_tx_queue_head = ZERO_INIT;
+static volatile uint8 usart_tx_queue_tail = ZERO_INIT;
+
+/* byte of the descriptor at the tail to be sent on the next interrupt */
+static uint16 usart_tx_queue_offset = ZERO_INIT;
+#endif
+
+#if USART_CFG_RX_RING_BUFFER
+/* UART RX Ring Buffer (single producer : USART RX Complete ISR >> head , single consumer : UART_read/UART_peek >> tail) */
+static volatile uint8 usart_rx_ring[USART_RX_RING_BUFFER_SIZE];
+static volatile uint8 usart_rx_head = ZERO_INIT;
+static volatile uint8 usart_rx_tail = ZERO_INIT;
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  get UBRR + 1 rounded to the nearest for a BAUD RATE : F_CPU / (divisor * baud) (limited to the 12-bit UBRR : 1..4096)
+ * @param  (baud_rate) the value of the BAUD RATE (not 0)
+ * @param  (divisor)   the divisor of the baud rate divider (16 >> normal speed , 8 >> double speed)
+ * @return UBRR + 1
+ */
+static uint16 USART_getUbrrDivider(uint32 baud_rate , uint8 divisor);
+
+
+/**
+ * @brief  get the error of the generated baud rate : (F_CPU - divisor * (UBRR + 1) * baud) / (divisor * (UBRR + 1) * baud)
+ * @param  (baud_rate) the value of the BAUD RATE (not 0)
+ * @param  (divisor)   the divisor of the baud rate divider (16 >> normal speed , 8 >> double speed)
+ * @param  (divider)   UBRR + 1
+ * @return the error in 0.01 % (positive >> faster than baud_rate)
+ */
+static sint16 USART_getBaudRateError(uint32 baud_rate , uint8 divisor , uint16 divider);
+
 
 /* ----------------------------------------------------------------------------------- */
 /* ------------functions definition section------------- */
@@ -64,14 +137,17 @@ static void (* USART_TX_Complete_InterruptHandler)(void) = NULL_PTR;
  * 			7-  Selects the number of Stop Bits to be inserted by the Transmitter
  * 					- 1 Stop Bit
  * 					- 2 Stop Bits
- * 			8-  Selects the BAUD RATE value and initialize the UBRR value
+ * 			8-  Selects the BAUD RATE value and initialize the UBRR value (rounded to the nearest)
+ * 					- for the configured speed
+ * 					- for the speed with the lowest error if the BAUD RATE solver is enabled
+ * 					- solved at compile time if the static BAUD RATE is enabled
  * 			9-  Set UART RX Complete Call Back if RX Complete Interrupt is enabled
  * 			10- Set UART TX Complete Call Back if TX Complete Interrupt is enabled
  * 			11- Set UART Data Register Empty Call Back if Data Register Empty Interrupt is enabled
  * 			12- Clear UART Frame Error, Data OverRun and Parity Error
  * @param  (uart_obj) pointer to the UART object passed by reference
  * @return (l_status) status of the performed operation
- *              (E_NOT_OK)  operation failed
+ *              (E_NOT_OK)  operation failed (or the BAUD RATE error is higher than USART_BAUD_RATE_MAX_ERROR with the solver >> UCSRB isn't written)
  *              (E_OK)      operation success
  */
 Std_ReturnType UART_init(uart_config_t *uart_obj)
@@ -79,6 +155,16 @@ Std_ReturnType UART_init(uart_config_t *uart_obj)
 	/* create a local variable to hold the status of the performed operation */
 	Std_ReturnType l_status = ZERO_INIT;
 
+	/* create local variables to hold the images of the USART Control and Status Registers */
+	UCSRA_CFG_t l_ucsra = { .Byte = ZERO_INIT };
+	UCSRB_CFG_t l_ucsrb = { .Byte = ZERO_INIT };
+	UCSRC_CFG_t l_ucsrc = { .Byte = ZERO_INIT };
+
+	#if !USART_CFG_STATIC_BAUD_RATE
+	/* create a local variable to hold the error of the generated baud rate */
+	sint16 l_baud_rate_error = ZERO_INIT;
+	#endif
+
 	/* check if the address is valid or not */
 	if(uart_obj == NULL_PTR)
 	{
@@ -94,68 +180,64 @@ Std_ReturnType UART_init(uart_config_t *uart_obj)
 
 		/* USART Asynchronous Mode Init */
 
-		/* --------------------------------- */
-		/* Enable/Disable USART Transmitter/Receiver */
-		_UCSRB._RXEN = uart_obj->receiver_enable;
-
-		/* Enable/Disable USART Transmitter */
-		_UCSRB._TXEN = uart_obj->transmitter_enable;
-		/* --------------------------------- */
+		/* the Registers images are built in local variables then every Register is written once
+		 	 (a read-modify-write of UCSRC reads UBRRH as they share the same I/O location) */
 
 		/* --------------------------------- */
 		/* Clear USART Transmit Complete Flag bit by writing a one to its bit location */
-		_UCSRA._TXC = SET;
-
-		/* Clear Frame Error Flag bit, Always set this bit to zero when writing to UCSRA */
-		_UCSRA._FE = UART_FRAME_ERROR_NOT_DETECTED;
+		l_ucsra._TXC = SET;
 
-		/* Clear Data OverRun Flag bit, Always set this bit to zero when writing to UCSRA */
-		_UCSRA._DOR = UART_DATA_OVERRUN_NOT_DETECTED;
-
-		/* Clear Parity Error Flag bit, Always set this bit to zero when writing to UCSRA */
-		_UCSRA._PE = UART_PARITY_ERROR_NOT_DETECTED;
+		/* Frame Error, Data OverRun and Parity Error Flags, Always set these bits to zero when writing to UCSRA */
+		l_ucsra._FE = UART_FRAME_ERROR_NOT_DETECTED;
+		l_ucsra._DOR = UART_DATA_OVERRUN_NOT_DETECTED;
+		l_ucsra._PE = UART_PARITY_ERROR_NOT_DETECTED;
 
 		/* Disable Multi-processor Communication Mode */
-		_UCSRA._MPCM = RESET;
+		l_ucsra._MPCM = RESET;
+
+		/* Selects USART Asynchronous Transmitter Speed */
+		#if USART_CFG_STATIC_BAUD_RATE
+		/* the speed with the lowest error for USART_STATIC_BAUD_RATE (solved at compile time) */
+		l_ucsra._U2X = TIMING_BAUD_U2X(USART_STATIC_BAUD_RATE);
+		#else
+		l_ucsra._U2X = uart_obj->asynchronous_tx_speed;
+		#endif
 		/* --------------------------------- */
 
 		/* --------------------------------- */
 		/* The URSEL must be one when writing the UCSRC */
-		_UCSRC._URSEL = SET;
+		l_ucsrc._URSEL = SET;
 
 		/* Select USART Mode : Asynchronous Mode */
-		_UCSRC._UMSEL = USART_ASYNCHRONOUS_MODE;
-
-		/* Selects USART Asynchronous Transmitter Speed */
-		_UCSRA._U2X = uart_obj->asynchronous_tx_speed;
+		l_ucsrc._UMSEL = USART_ASYNCHRONOUS_MODE;
 
 		/* Enable/Disable Parity Mode */
-		_UCSRC._UPMx = uart_obj->parity_mode;
+		l_ucsrc._UPMx = uart_obj->parity_mode;
 
 		/* selects the number of Stop Bits to be inserted by the Transmitter */
-		_UCSRC._USBS = uart_obj->stop_mode;
+		l_ucsrc._USBS = uart_obj->stop_mode;
 
 		/* sets the number of data bits (Character Size) in a frame the receiver and transmitter use */
 		switch(uart_obj->char_size)
 		{
 			case UART_CHARACTER_SIZE_5_BITS	:	/* Data Bits = 5 bits */
-												_UCSRC._UCSZ0 = RESET; _UCSRC._UCSZ1 = RESET; _UCSRB._UCSZ2 = RESET;
+												l_ucsrc._UCSZ0 = RESET; l_ucsrc._UCSZ1 = RESET; l_ucsrb._UCSZ2 = RESET;
 												break;
 
 			case UART_CHARACTER_SIZE_6_BITS	:	/* Data Bits = 6 bits */
-												_UCSRC._UCSZ0 = SET;   _UCSRC._UCSZ1 = RESET; _UCSRB._UCSZ2 = RESET;
+												l_ucsrc._UCSZ0 = SET;   l_ucsrc._UCSZ1 = RESET; l_ucsrb._UCSZ2 = RESET;
 												break;
 
 			case UART_CHARACTER_SIZE_7_BITS	:	/* Data Bits = 7 bits */
-												_UCSRC._UCSZ0 = RESET; _UCSRC._UCSZ1 = SET;   _UCSRB._UCSZ2 = RESET;
+												l_ucsrc._UCSZ0 = RESET; l_ucsrc._UCSZ1 = SET;   l_ucsrb._UCSZ2 = RESET;
 												break;
 
 			case UART_CHARACTER_SIZE_8_BITS	:	/* Data Bits = 8 bits */
-												_UCSRC._UCSZ0 = SET;   _UCSRC._UCSZ1 = SET;   _UCSRB._UCSZ2 = RESET;
+												l_ucsrc._UCSZ0 = SET;   l_ucsrc._UCSZ1 = SET;   l_ucsrb._UCSZ2 = RESET;
 												break;
 
 			case UART_CHARACTER_SIZE_9_BITS	:	/* Data Bits = 9 bits */
-												_UCSRC._UCSZ0 = SET;   _UCSRC._UCSZ1 = SET;   _UCSRB._UCSZ2 = SET;
+												l_ucsrc._UCSZ0 = SET;   l_ucsrc._UCSZ1 = SET;   l_ucsrb._UCSZ2 = SET;
 												break;
 
 			default	:	/* Nothing */
@@ -164,14 +246,51 @@ Std_ReturnType UART_init(uart_config_t *uart_obj)
 		/* --------------------------------- */
 
 		/* --------------------------------- */
-		/* Selects the BAUD RATE value and initialize the UBRR value */
-		UART_setBaudRate(uart_obj->Baud_Rate);
+		/* Enable/Disable USART Receiver */
+		l_ucsrb._RXEN = uart_obj->receiver_enable;
+
+		/* Enable/Disable USART Transmitter */
+		l_ucsrb._TXEN = uart_obj->transmitter_enable;
+
+		/* Enable/Disable RX Complete, TX Complete and Data Register Empty Interrupts */
+		l_ucsrb._RXCIE = uart_obj->rx_complete_interrupt_en;
+		l_ucsrb._TXCIE = uart_obj->tx_complete_interrupt_en;
+		l_ucsrb._UDRIE = uart_obj->tx_buffer_reg_empty_interrupt_en;
+		/* --------------------------------- */
+
 		/* --------------------------------- */
+		/* write the speed first as UART_setBaudRate reads it */
+		_UCSRA.Byte = l_ucsra.Byte;
+
+		/* Selects the BAUD RATE value and initialize the UBRR value (UBRRH is written with URSEL = 0) */
+		#if USART_CFG_STATIC_BAUD_RATE
+		/* UBRR solved at compile time (UBRRL is written last as it updates the baud rate prescaler) */
+		_UBRRH.Byte = (uint8)( TIMING_BAUD_UBRR(USART_STATIC_BAUD_RATE) >> 8 );
+		_UBRRL.Byte = (uint8)( TIMING_BAUD_UBRR(USART_STATIC_BAUD_RATE) );
+		#else
+		if(uart_obj->baud_rate_solver == USART_BAUD_RATE_SOLVER_ENABLE)
+		{
+			/* the speed with the lowest error is selected, the error must be within USART_BAUD_RATE_MAX_ERROR */
+			l_baud_rate_error = UART_setBaudRateBest(uart_obj->Baud_Rate);
+
+			if( (l_baud_rate_error > USART_BAUD_RATE_MAX_ERROR) || (l_baud_rate_error < -USART_BAUD_RATE_MAX_ERROR) )
+			{
+				l_status = E_NOK;		/* operation failed */
+			}
+			else{ /* Nothing */ }
+		}
+		else
+		{
+			/* UBRR for the configured speed */
+			(void)UART_setBaudRate(uart_obj->Baud_Rate);
+		}
+		#endif
 
+		/* frame format (UCSRC is written with URSEL = 1) */
+		_UCSRC.Byte = l_ucsrc.Byte;
 		/* --------------------------------- */
-		/* Enable/Disable RX Complete Interrupt */
-		_UCSRB._RXCIE = uart_obj->rx_complete_interrupt_en;
 
+		/* --------------------------------- */
 		/* Set RX Complete Call Back if RX Complete Interrupt is enabled */
 		#if USART_CFG_RX_COMPLETE_INTERRUPT
 		if(uart_obj->rx_complete_interrupt_en == USART_RX_COMPLETE_INTERRUPT_DISABLE)
@@ -188,9 +307,6 @@ Std_ReturnType UART_init(uart_config_t *uart_obj)
 		#endif
 
 
-		/* Enable/Disable TX Complete Interrupt */
-		_UCSRB._TXCIE = uart_obj->tx_complete_interrupt_en;
-
 		#if USART_CFG_TX_COMPLETE_INTERRUPT
 		/* Set TX Complete Call Back if TX Complete Interrupt is enabled */
 		if(uart_obj->tx_complete_interrupt_en == USART_TX_COMPLETE_INTERRUPT_DISABLE)
@@ -207,9 +323,6 @@ Std_ReturnType UART_init(uart_config_t *uart_obj)
 		#endif
 
 
-		/* Enable/Disable USART Data Register Empty Interrupt */
-		_UCSRB._UDRIE = uart_obj->tx_buffer_reg_empty_interrupt_en;
-
 		#if USART_CFG_TX_BUFFER_EMPTY_INTERRUPT
 		/* Set USART Data Register Empty Call Back if USART Data Register Empty Interrupt is enabled */
 		if(uart_obj->tx_buffer_reg_empty_interrupt_en == USART_TX_BUFFER_REGISTER_EMPTY_INTERRUPT_DISABLE)
@@ -225,6 +338,32 @@ Std_ReturnType UART_init(uart_config_t *uart_obj)
 		else{ /* Nothing */ }
 		#endif
 		/* --------------------------------- */
+
+		/* --------------------------------- */
+		/* empty the TX ring buffer, the TX descriptor queue and the RX ring buffer */
+		#if USART_CFG_TX_RING_BUFFER
+		usart_tx_head = ZERO_INIT;
+		usart_tx_tail = ZERO_INIT;
+		#endif
+		#if USART_CFG_TX_DESCRIPTOR_QUEUE
+		usart_tx_queue_head = ZERO_INIT;
+		usart_tx_queue_tail = ZERO_INIT;
+		usart_tx_queue_offset = ZERO_INIT;
+		#endif
+		#if USART_CFG_RX_RING_BUFFER
+		usart_rx_head = ZERO_INIT;
+		usart_rx_tail = ZERO_INIT;
+		#endif
+		/* --------------------------------- */
+
+		/* --------------------------------- */
+		/* enable the USART and its interrupts after the call backs are set (it stays disabled if no UBRR is within the error) */
+		if(E_OK == l_status)
+		{
+			_UCSRB.Byte = l_ucsrb.Byte;
+		}
+		else{ /* Nothing */ }
+		/* --------------------------------- */
 	}
 
 	return l_status;
@@ -282,34 +421,141 @@ uint16 UART_recieveByte(void)
 
 
 /**
- * @brief  Selects the BAUD RATE value and initialize the UBRR value
+ * @brief  Selects the BAUD RATE value and initialize the UBRR value (rounded to the nearest) for the configured speed (U2X)
  * @param  (baud_rate) the value of the BAUD RATE
+ * @return the error of the generated baud rate in 0.01 % (positive >> faster than baud_rate), the UBRR isn't changed for 0 baud
  */
-void UART_setBaudRate(uint32 baud_rate)
+sint16 UART_setBaudRate(uint32 baud_rate)
 {
-	/* create a local variable to hold the value of UBRR */
-	uint16 ubrr_val = ZERO_INIT;
+	/* create a local variable to hold the error of the generated baud rate */
+	sint16 l_error = USART_BAUD_RATE_ERROR_LIMIT;
+
+	/* create a local variable to hold the divisor of the baud rate divider */
+	uint8 l_divisor = 16;
+
+	/* create a local variable to hold the value of UBRR + 1 */
+	uint16 l_divider = ZERO_INIT;
 
 	/* check which transmit speed is configured */
 	switch(_UCSRA._U2X)
 	{
 		case UART_NORMAL_SPEED_MODE	:	/* Asynchronous Normal Mode : the divisor of the baud rate divider remains 16 */
-										ubrr_val = (uint16)( ( (CPU_FREQUENCY) / (16 * (baud_rate)) ) - 1 );
+										l_divisor = 16;
 										break;
 
 		case UART_DOUBLE_SPEED_MODE	:	/* Asynchronous Double Speed Mode : reduce the divisor of the baud rate divider from 16 to 8  */
-										ubrr_val = (uint16)( ( (CPU_FREQUENCY) / (8 * (baud_rate)) ) - 1 );
+										l_divisor = 8;
 										break;
 
 		default		:	/* Nothing */
 						break;
 	}
 
-	/* The URSEL must be zero when writing the UBRRH */
-	//_UBRRH._URSEL = RESET;
-	/* Set the UBRR value for the required BAUD RATE */
-	_UBRRL.Byte = (uint8)(ubrr_val);
-	_UBRRH.Byte= (uint8)( (ubrr_val) >> 8 );
+	if(baud_rate != ZERO_INIT)
+	{
+		l_divider = USART_getUbrrDivider(baud_rate , l_divisor);
+		l_error = USART_getBaudRateError(baud_rate , l_divisor , l_divider);
+
+		/* Set the UBRR value for the required BAUD RATE (The URSEL must be zero when writing the UBRRH,
+		 	 UBRRL is written last as it updates the baud rate prescaler) */
+		_UBRRH.Byte = (uint8)( (l_divider - 1) >> 8 );
+		_UBRRL.Byte = (uint8)(l_divider - 1);
+	}
+	else{ /* Nothing */ }
+
+	return l_error;
+}
+
+
+/**
+ * @brief  Selects the BAUD RATE value : evaluate both speeds (normal/double) with the rounded UBRR
+ * 			and initialize UBRR and U2X with the lowest error (normal speed on a tie)
+ * @param  (baud_rate) the value of the BAUD RATE
+ * @return the error of the generated baud rate in 0.01 % (positive >> faster than baud_rate), the UBRR isn't changed for 0 baud
+ */
+sint16 UART_setBaudRateBest(uint32 baud_rate)
+{
+	/* create a local variable to hold the error of the generated baud rate */
+	sint16 l_error = USART_BAUD_RATE_ERROR_LIMIT;
+
+	/* create local variables to hold UBRR + 1 and the error of both speeds */
+	uint16 l_normal_divider = ZERO_INIT;
+	uint16 l_double_divider = ZERO_INIT;
+	sint16 l_normal_error = USART_BAUD_RATE_ERROR_LIMIT;
+	sint16 l_double_error = USART_BAUD_RATE_ERROR_LIMIT;
+
+	if(baud_rate != ZERO_INIT)
+	{
+		l_normal_divider = USART_getUbrrDivider(baud_rate , 16);
+		l_normal_error = USART_getBaudRateError(baud_rate , 16 , l_normal_divider);
+
+		l_double_divider = USART_getUbrrDivider(baud_rate , 8);
+		l_double_error = USART_getBaudRateError(baud_rate , 8 , l_double_divider);
+
+		/* Normal Speed samples each bit more times so it's selected unless Double Speed has a lower error */
+		if( ( (l_double_error < 0) ? -l_double_error : l_double_error ) < ( (l_normal_error < 0) ? -l_normal_error : l_normal_error ) )
+		{
+			(void)UART_setBaudRateDivider( (uint16)(l_double_divider - 1) , UART_DOUBLE_SPEED_MODE );
+			l_error = l_double_error;
+		}
+		else
+		{
+			(void)UART_setBaudRateDivider( (uint16)(l_normal_divider - 1) , UART_NORMAL_SPEED_MODE );
+			l_error = l_normal_error;
+		}
+	}
+	else{ /* Nothing */ }
+
+	return l_error;
+}
+
+
+/**
+ * @brief  Set the UBRR value and the Asynchronous Transmit Speed directly (e.g. from a measured bit width)
+ * @param  (ubrr_val) the value of UBRR (0..4095)
+ * @param  (tx_speed) the Asynchronous Transmit Speed >> @ref : USART Asynchronous Transmit Speed
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType UART_setBaudRateDivider(uint16 ubrr_val , uart_tx_speed_t tx_speed)
+{
+	/* create a local variable to hold the status of the performed operation */
+	Std_ReturnType l_status = ZERO_INIT;
+
+	/* create a local variable to hold the image of UCSRA */
+	UCSRA_CFG_t l_ucsra = { .Byte = ZERO_INIT };
+
+	/* UBRR is a 12-bit Register */
+	if( (ubrr_val > 0x0FFF) || (tx_speed > UART_DOUBLE_SPEED_MODE) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		l_status = E_OK;		/* operation success */
+
+		/* UCSRA is written as a whole : the flags (TXC, FE, DOR, PE) are written zero so they are kept, MPCM is kept */
+		l_ucsra._MPCM = _UCSRA._MPCM;
+		l_ucsra._U2X = tx_speed;
+		_UCSRA.Byte = l_ucsra.Byte;
+
+		/* Set the UBRR value (UBRRH is written with URSEL = 0, writing UBRRL updates the baud rate prescaler) */
+		_UBRRH.Byte = (uint8)( (ubrr_val) >> 8 );
+		_UBRRL.Byte = (uint8)(ubrr_val);
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  Enable/Disable the USART Receiver (disabling it flushes the receive buffer)
+ * @param  (receiver_enable) >> @ref : RXEN: Receiver Enable
+ */
+void UART_setReceiverState(uint8 receiver_enable)
+{
+	_UCSRB._RXEN = receiver_enable;
 }
 
 
@@ -407,6 +653,252 @@ Std_ReturnType UART_receiveString(uint8 * const p_str)
 }
 
 
+#if USART_CFG_TX_RING_BUFFER
+/**
+ * @brief  Send data to another device through UART without waiting :
+ * 			1- Copy the data to the TX ring buffer (as much as its free space)
+ * 			2- Enable the USART Data Register Empty Interrupt which sends the ring
+ * @param  (p_data) pointer to the data you want to send
+ * @param  (length) number of bytes of the data
+ * @return the number of bytes copied to the ring (less than length if the ring is full, 0 if NULL pointer is passed)
+ */
+uint16 UART_write(const uint8 * const p_data , uint16 length)
+{
+	/* create a local variable to hold the number of bytes copied to the ring */
+	uint16 l_count = ZERO_INIT;
+	/* create local variables to hold the free space of the ring and the head index */
+	uint8 l_free = ZERO_INIT;
+	uint8 l_head = usart_tx_head;
+
+	/* check if the address is valid or not */
+	if(p_data != NULL_PTR)
+	{
+		/* the tail is read once, the ISR may only increase the free space after that */
+		l_free = (uint8)( USART_TX_RING_BUFFER_SIZE - (uint8)(l_head - usart_tx_tail) );
+
+		/* copy the data to the ring */
+		while( (l_count < length) && (l_count < l_free) )
+		{
+			usart_tx_ring[ USART_TX_RING_INDEX(l_head) ] = p_data[l_count];
+			l_head++;
+			l_count++;
+		}
+
+		if(l_count > 0)
+		{
+			/* the bytes are published to the ISR by one store of the head */
+			usart_tx_head = l_head;
+
+			/* Enable the USART Data Register Empty Interrupt (single bit write >> sbi instruction, interrupt safe) */
+			_UCSRB._UDRIE = USART_TX_BUFFER_REGISTER_EMPTY_INTERRUPT_ENABLE;
+		}
+		else{ /* Nothing */ }
+	}
+	else{ /* Nothing */ }
+
+	return l_count;
+}
+#endif
+
+
+#if USART_CFG_TX_DESCRIPTOR_QUEUE
+/**
+ * @brief  queue a descriptor of data to be sent by the USART Data Register Empty ISR (the descriptor is copied, its data is not)
+ * @param  (descriptor) pointer to the descriptor
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (the queue is full, empty data or NULL pointer is passed)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType UART_queueTx(const uart_tx_descriptor_t *descriptor)
+{
+	/* create a local variable to hold the status of the performed operation */
+	Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the Status Register */
+	uint8 l_sreg = ZERO_INIT;
+	/* create a local variable to hold the head index */
+	uint8 l_head = ZERO_INIT;
+
+	if( (NULL_PTR == descriptor) || (NULL_PTR == descriptor->data) || (ZERO_INIT == descriptor->length) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		/* disable the interrupts so a Done Call Back can't queue a descriptor in the same place */
+		CRITICAL_SECTION_ENTER(l_sreg);
+
+		l_head = usart_tx_queue_head;
+
+		if( (uint8)(l_head - usart_tx_queue_tail) < USART_TX_DESCRIPTOR_QUEUE_SIZE )
+		{
+			l_status = E_OK;		/* operation success */
+
+			usart_tx_queue[ USART_TX_QUEUE_INDEX(l_head) ] = *descriptor;
+			usart_tx_queue_head = (uint8)(l_head + 1);
+
+			/* Enable the USART Data Register Empty Interrupt which sends the queue */
+			_UCSRB._UDRIE = USART_TX_BUFFER_REGISTER_EMPTY_INTERRUPT_ENABLE;
+		}
+		else
+		{
+			l_status = E_NOK;		/* operation failed (the queue is full) */
+		}
+
+		CRITICAL_SECTION_EXIT(l_sreg);
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  get the number of free descriptors in the TX queue (e.g. to queue all the descriptors of a frame at once)
+ * @return the number of descriptors which can be queued
+ */
+uint8 UART_getTxQueueFree(void)
+{
+	return (uint8)( USART_TX_DESCRIPTOR_QUEUE_SIZE - (uint8)(usart_tx_queue_head - usart_tx_queue_tail) );
+}
+#endif
+
+#if USART_CFG_RX_RING_BUFFER
+/**
+ * @brief  get the number of received bytes waiting in the RX ring buffer
+ * @return the number of bytes which can be read without waiting
+ */
+uint8 UART_available(void)
+{
+	/* the head is read once, the ISR may only add bytes after that */
+	return (uint8)(usart_rx_head - usart_rx_tail);
+}
+
+
+/**
+ * @brief  Receive data from another device through UART without waiting :
+ * 			move the received bytes from the RX ring buffer (as much as max_length)
+ * @param  (p_data)     pointer to the buffer to be filled with the received data
+ * @param  (max_length) size of the buffer in bytes
+ * @return the number of bytes read (0 if the ring is empty or NULL pointer is passed)
+ */
+uint16 UART_read(uint8 * const p_data , uint16 max_length)
+{
+	/* create a local variable to hold the number of bytes read from the ring */
+	uint16 l_count = ZERO_INIT;
+	/* create local variables to hold the number of bytes in the ring and the tail index */
+	uint8 l_available = ZERO_INIT;
+	uint8 l_tail = usart_rx_tail;
+
+	/* check if the address is valid or not */
+	if(p_data != NULL_PTR)
+	{
+		l_available = (uint8)(usart_rx_head - l_tail);
+
+		/* copy the data from the ring */
+		while( (l_count < max_length) && (l_count < l_available) )
+		{
+			p_data[l_count] = usart_rx_ring[ USART_RX_RING_INDEX(l_tail) ];
+			l_tail++;
+			l_count++;
+		}
+
+		/* the read bytes are given back to the ISR by one store of the tail */
+		usart_rx_tail = l_tail;
+	}
+	else{ /* Nothing */ }
+
+	return l_count;
+}
+
+
+/**
+ * @brief  get the next received byte without removing it from the RX ring buffer
+ * @param  (p_data)   pointer to the variable to be filled with the byte
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (the ring is empty or NULL pointer is passed)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType UART_peek(uint8 * const p_data)
+{
+	/* create a local variable to hold the status of the performed operation */
+	Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the tail index */
+	uint8 l_tail = usart_rx_tail;
+
+	/* check if the address is valid and the ring isn't empty */
+	if( (p_data == NULL_PTR) || (l_tail == usart_rx_head) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		l_status = E_OK;		/* operation success */
+
+		*p_data = usart_rx_ring[ USART_RX_RING_INDEX(l_tail) ];
+	}
+
+	return l_status;
+}
+#endif
+
+
+/**
+ * @brief  get UBRR + 1 rounded to the nearest for a BAUD RATE : F_CPU / (divisor * baud) (limited to the 12-bit UBRR : 1..4096)
+ * @param  (baud_rate) the value of the BAUD RATE (not 0)
+ * @param  (divisor)   the divisor of the baud rate divider (16 >> normal speed , 8 >> double speed)
+ * @return UBRR + 1
+ */
+static uint16 USART_getUbrrDivider(uint32 baud_rate , uint8 divisor)
+{
+	/* create a local variable to hold the CPU cycles of a bit cell per (UBRR + 1) times baud */
+	uint32 l_cycles = (uint32)divisor * baud_rate;
+
+	/* create a local variable to hold UBRR + 1 rounded to the nearest (same as TIMING_UBRR_DIVIDER) */
+	uint32 l_divider = ( (CPU_FREQUENCY) + (l_cycles / 2) ) / l_cycles;
+
+	if(l_divider < 1)
+	{
+		l_divider = 1;
+	}
+	else if(l_divider > 4096)
+	{
+		l_divider = 4096;
+	}
+	else{ /* Nothing */ }
+
+	return (uint16)l_divider;
+}
+
+
+/**
+ * @brief  get the error of the generated baud rate : (F_CPU - divisor * (UBRR + 1) * baud) / (divisor * (UBRR + 1) * baud)
+ * @param  (baud_rate) the value of the BAUD RATE (not 0)
+ * @param  (divisor)   the divisor of the baud rate divider (16 >> normal speed , 8 >> double speed)
+ * @param  (divider)   UBRR + 1
+ * @return the error in 0.01 % (positive >> faster than baud_rate)
+ */
+static sint16 USART_getBaudRateError(uint32 baud_rate , uint8 divisor , uint16 divider)
+{
+	/* create a local variable to hold the CPU cycles of (baud) bit cells (F_CPU if the baud rate is exact) */
+	uint32 l_cycles = (uint32)divisor * divider * baud_rate;
+
+	/* create a local variable to hold the error (divided by cycles / 10000 so the 32-bit calculation can't overflow,
+	 	 same as TIMING_BAUD_ERROR) */
+	sint32 l_error = ( (sint32)(CPU_FREQUENCY) - (sint32)l_cycles ) / (sint32)(l_cycles / 10000UL);
+
+	if(l_error > USART_BAUD_RATE_ERROR_LIMIT)
+	{
+		l_error = USART_BAUD_RATE_ERROR_LIMIT;
+	}
+	else if(l_error < -USART_BAUD_RATE_ERROR_LIMIT)
+	{
+		l_error = -USART_BAUD_RATE_ERROR_LIMIT;
+	}
+	else{ /* Nothing */ }
+
+	return (sint16)l_error;
+}
+
+
 /* ----------------------------------------------------------------------------------- */
 /* --------------------ISR section---------------------- */
 
@@ -417,13 +909,36 @@ Std_ReturnType UART_receiveString(uint8 * const p_str)
 #if USART_CFG_RX_COMPLETE_INTERRUPT
 ISR(USART_RXC_vect)
 {
+	#if USART_CFG_RX_RING_BUFFER
+	/* create local variables to hold the received byte and the head index */
+	uint8 l_data = ZERO_INIT;
+	uint8 l_head = usart_rx_head;
+	#endif
+
 	/* check if the call back notification contains NULL or not */
 	if(USART_RX_Complete_InterruptHandler)
 	{
-		/* Call Back */
+		/* Call Back (raw access to UDR) */
 		(*USART_RX_Complete_InterruptHandler)();
 	}
+	#if USART_CFG_RX_RING_BUFFER
+	else
+	{
+		/* UDR is read in any case to clear RXC */
+		l_data = _UDR.Byte;
+
+		/* copy the byte to the RX ring buffer if it isn't full */
+		if( (uint8)(l_head - usart_rx_tail) < USART_RX_RING_BUFFER_SIZE )
+		{
+			usart_rx_ring[ USART_RX_RING_INDEX(l_head) ] = l_data;
+			/* the byte is published to UART_read by one store of the head */
+			usart_rx_head = (uint8)(l_head + 1);
+		}
+		else{ /* Nothing */ }
+	}
+	#else
 	else{ /* Nothing */ }
+	#endif
 }
 #endif
 
@@ -451,6 +966,94 @@ ISR(USART_TXC_vect)
  */
 ISR(USART_UDRE_vect)
 {
+	#if USART_CFG_TX_RING_BUFFER
+	/* create a local variable to hold the tail index */
+	uint8 l_tail = usart_tx_tail;
+
+	/* send the next byte of the TX ring buffer */
+	if(l_tail != usart_tx_head)
+	{
+		_UDR.Byte = usart_tx_ring[ USART_TX_RING_INDEX(l_tail) ];
+		l_tail++;
+		usart_tx_tail = l_tail;
+	}
+	else{ /* Nothing */ }
+
+	/* check if the ring is empty */
+	if(l_tail == usart_tx_head)
+	{
+		/* Disable the USART Data Register Empty Interrupt till UART_write is called again */
+		_UCSRB._UDRIE = USART_TX_BUFFER_REGISTER_EMPTY_INTERRUPT_DISABLE;
+
+		/* check if the call back notification contains NULL or not */
+		if(USART_TX_BufferEmpty_InterruptHandler)
+		{
+			/* Call Back */
+			(*USART_TX_BufferEmpty_InterruptHandler)();
+		}
+		else{ /* Nothing */ }
+	}
+	else{ /* Nothing */ }
+	#elif USART_CFG_TX_DESCRIPTOR_QUEUE
+	/* create a local variable to hold the tail index */
+	uint8 l_tail = usart_tx_queue_tail;
+	/* create a local pointer to hold the descriptor being sent */
+	const uart_tx_descriptor_t *l_descriptor = &usart_tx_queue[ USART_TX_QUEUE_INDEX(l_tail) ];
+	/* create a local pointer to hold the Done Call Back of the descriptor (its place may be reused by the Call Back) */
+	void (* l_done_handler)(void) = NULL_PTR;
+
+	/* --------------------------------- */
+	/* send the next byte of the descriptor at the tail from RAM or flash */
+	if(l_tail != usart_tx_queue_head)
+	{
+		if(UART_TX_MEMORY_FLASH == l_descriptor->memory)
+		{
+			_UDR.Byte = pgm_read_byte(l_descriptor->data + usart_tx_queue_offset);
+		}
+		else
+		{
+			_UDR.Byte = l_descriptor->data[usart_tx_queue_offset];
+		}
+
+		usart_tx_queue_offset++;
+
+		/* move to the next descriptor after the last byte */
+		if(usart_tx_queue_offset >= l_descriptor->length)
+		{
+			usart_tx_queue_offset = ZERO_INIT;
+			l_done_handler = l_descriptor->UART_TX_DoneHandler;
+			usart_tx_queue_tail = (uint8)(l_tail + 1);
+
+			if(l_done_handler)
+			{
+				/* Call Back */
+				(*l_done_handler)();
+			}
+			else{ /* Nothing */ }
+		}
+		else{ /* Nothing */ }
+	}
+	else{ /* Nothing */ }
+	/* --------------------------------- */
+
+	/* --------------------------------- */
+	/* check if the queue is empty (a Done Call Back may have queued a descriptor) */
+	if(usart_tx_queue_tail == usart_tx_queue_head)
+	{
+		/* Disable the USART Data Register Empty Interrupt till UART_queueTx is called again */
+		_UCSRB._UDRIE = USART_TX_BUFFER_REGISTER_EMPTY_INTERRUPT_DISABLE;
+
+		/* check if the call back notification contains NULL or not */
+		if(USART_TX_BufferEmpty_InterruptHandler)
+		{
+			/* Call Back */
+			(*USART_TX_BufferEmpty_InterruptHandler)();
+		}
+		else{ /* Nothing */ }
+	}
+	else{ /* Nothing */ }
+	/* --------------------------------- */
+	#else
 	/* check if the call back notification contains NULL or not */
 	if(USART_TX_BufferEmpty_InterruptHandler)
 	{
@@ -458,6 +1061,7 @@ ISR(USART_UDRE_vect)
 		(*USART_TX_BufferEmpty_InterruptHandler)();
 	}
 	else{ /* Nothing */ }
+	#endif
 }
 #endif
 
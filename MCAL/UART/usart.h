@@ -14,6 +14,8 @@
 #define _USART_H_
 /* ----------------------------------------------------------------------------------- */
 /* ------------------Includes section------------------- */
+#include <avr/pgmspace.h>			/* For TX data stored in flash */
+
 #include "ATmega32.h"
 
 
@@ -34,6 +36,97 @@
 #define USART_CFG_TX_COMPLETE_INTERRUPT						USART_CFG_DISABLE
 #define USART_CFG_TX_BUFFER_EMPTY_INTERRUPT					USART_CFG_DISABLE
 
+/* --------------------------------- */
+/* UART TX Ring Buffer Enable/Disable */
+/* NOTE: if enabled UART_write copies the data to the TX ring buffer and returns, the USART Data Register Empty ISR sends
+ *       the ring (UDRIE is set by UART_write and cleared by the ISR when the ring is empty) */
+/* NOTE: it needs the USART Data Register Empty ISR (USART_CFG_TX_BUFFER_EMPTY_INTERRUPT), its Call Back is called
+ *       when the last byte of the ring is written to UDR */
+/* NOTE: UART_sendByte/UART_sendString must not be called while the ring isn't empty */
+
+#define USART_CFG_TX_RING_BUFFER							USART_CFG_DISABLE
+
+/* size of the TX ring buffer in bytes (power of two : 2..128) */
+#define USART_TX_RING_BUFFER_SIZE							64
+
+/* --------------------------------- */
+/* UART TX Descriptor Queue Enable/Disable */
+/* NOTE: if enabled UART_queueTx queues a descriptor (pointer, length) of data in RAM or flash, the USART Data Register Empty ISR
+ *       sends the queued descriptors in order straight from the memory of the caller (no copy and no temporary buffer) and
+ *       calls the Done Call Back of every descriptor (ISR context) when its last byte is written to UDR */
+/* NOTE: the data must be kept unchanged till its Done Call Back is called, the descriptor itself is copied to the queue */
+/* NOTE: it needs the USART Data Register Empty ISR (USART_CFG_TX_BUFFER_EMPTY_INTERRUPT), its Call Back is called
+ *       when the queue is empty, it can't be enabled with the TX ring buffer */
+
+#define USART_CFG_TX_DESCRIPTOR_QUEUE						USART_CFG_DISABLE
+
+/* number of descriptors of the TX queue (power of two : 2..128) */
+#define USART_TX_DESCRIPTOR_QUEUE_SIZE						8
+
+/* --------------------------------- */
+/* UART RX Ring Buffer Enable/Disable */
+/* NOTE: if enabled the USART RX Complete ISR copies every received byte to the RX ring buffer when no RX Complete
+ *       Call Back is set (a Call Back set by UART_init keeps the raw access to UDR), the ring is read by UART_available,
+ *       UART_read and UART_peek without waiting */
+/* NOTE: it needs the USART RX Complete ISR (USART_CFG_RX_COMPLETE_INTERRUPT) and rx_complete_interrupt_en = ENABLE */
+/* NOTE: the bytes received while the ring is full are lost, the ninth data bit (RXB8) isn't kept */
+
+#define USART_CFG_RX_RING_BUFFER							USART_CFG_DISABLE
+
+/* size of the RX ring buffer in bytes (power of two : 2..128) */
+#define USART_RX_RING_BUFFER_SIZE							64
+
+/* --------------------------------- */
+/* UART BAUD RATE solver */
+/* NOTE: the solver rounds UBRR to the nearest for both speeds (normal >> divisor 16 , double >> divisor 8) and selects the
+ *       speed with the lowest error (normal speed on a tie), the error is given in 0.01 % of the baud rate */
+
+/* maximum error of the generated baud rate accepted by the solver in 0.01 % (200 >> 2.00 %) */
+#define USART_BAUD_RATE_MAX_ERROR							200
+
+/* UART static BAUD RATE Enable/Disable */
+/* NOTE: if enabled UBRR and U2X are solved at compile time for USART_STATIC_BAUD_RATE and written by UART_init
+ *       (Baud_Rate, asynchronous_tx_speed and baud_rate_solver of the UART object are ignored),
+ *       the build fails if the error is higher than USART_BAUD_RATE_MAX_ERROR */
+/* NOTE: USART_STATIC_BAUD_RATE is a plain number as #if can't evaluate the casts of the BAUD RATE Select macros */
+/* NOTE: 250000 baud is exact at 8 and 16 MHz, 115200 baud isn't generated within 2 % (3.55 % at 8 MHz , 2.12 % at 16 MHz) */
+
+#define USART_CFG_STATIC_BAUD_RATE							USART_CFG_DISABLE
+
+#define USART_STATIC_BAUD_RATE								250000
+
+#if USART_CFG_TX_RING_BUFFER && !USART_CFG_TX_BUFFER_EMPTY_INTERRUPT
+#error "USART_CFG_TX_RING_BUFFER needs USART_CFG_TX_BUFFER_EMPTY_INTERRUPT to be enabled"
+#endif
+
+#if USART_CFG_TX_DESCRIPTOR_QUEUE && !USART_CFG_TX_BUFFER_EMPTY_INTERRUPT
+#error "USART_CFG_TX_DESCRIPTOR_QUEUE needs USART_CFG_TX_BUFFER_EMPTY_INTERRUPT to be enabled"
+#endif
+
+#if USART_CFG_TX_DESCRIPTOR_QUEUE && USART_CFG_TX_RING_BUFFER
+#error "USART_CFG_TX_DESCRIPTOR_QUEUE and USART_CFG_TX_RING_BUFFER can't be enabled at the same time"
+#endif
+
+#if USART_CFG_RX_RING_BUFFER && !USART_CFG_RX_COMPLETE_INTERRUPT
+#error "USART_CFG_RX_RING_BUFFER needs USART_CFG_RX_COMPLETE_INTERRUPT to be enabled"
+#endif
+
+#if USART_CFG_STATIC_BAUD_RATE && ( TIMING_BAUD_BEST_ERROR(USART_STATIC_BAUD_RATE) > USART_BAUD_RATE_MAX_ERROR )
+#error "USART_STATIC_BAUD_RATE can't be generated from CPU_FREQUENCY within USART_BAUD_RATE_MAX_ERROR"
+#endif
+
+#if ( USART_TX_RING_BUFFER_SIZE < 2 ) || ( USART_TX_RING_BUFFER_SIZE > 128 ) || ( USART_TX_RING_BUFFER_SIZE & ( USART_TX_RING_BUFFER_SIZE - 1 ) )
+#error "USART_TX_RING_BUFFER_SIZE must be a power of two from 2 to 128"
+#endif
+
+#if ( USART_TX_DESCRIPTOR_QUEUE_SIZE < 2 ) || ( USART_TX_DESCRIPTOR_QUEUE_SIZE > 128 ) || ( USART_TX_DESCRIPTOR_QUEUE_SIZE & ( USART_TX_DESCRIPTOR_QUEUE_SIZE - 1 ) )
+#error "USART_TX_DESCRIPTOR_QUEUE_SIZE must be a power of two from 2 to 128"
+#endif
+
+#if ( USART_RX_RING_BUFFER_SIZE < 2 ) || ( USART_RX_RING_BUFFER_SIZE > 128 ) || ( USART_RX_RING_BUFFER_SIZE & ( USART_RX_RING_BUFFER_SIZE - 1 ) )
+#error "USART_RX_RING_BUFFER_SIZE must be a power of two from 2 to 128"
+#endif
+
 /* --------------------------------- */
 /* USART Transmit/Receive Flags */
 
@@ -89,6 +182,21 @@
 #define USART_TRANSMITTER_DISABLE							0
 #define USART_TRANSMITTER_ENABLE							1
 
+/* --------------------------------- */
+/* @ref : USART BAUD RATE Solver */
+
+/* UBRR is solved for the asynchronous_tx_speed of the UART object */
+#define USART_BAUD_RATE_SOLVER_DISABLE						0
+/* the speed with the lowest error is selected (asynchronous_tx_speed is ignored),
+   UART_init fails and leaves the USART disabled if the error is higher than USART_BAUD_RATE_MAX_ERROR */
+#define USART_BAUD_RATE_SOLVER_ENABLE						1
+
+/* --------------------------------- */
+/* @ref : UART TX Data Memory */
+
+#define UART_TX_MEMORY_RAM									0
+#define UART_TX_MEMORY_FLASH								1
+
 /* --------------------------------- */
 /* @ref : BAUD RATE Select */
 
@@ -136,6 +244,8 @@ typedef struct{
 	uint16 mode_select						:1;
 	/* Selects USART Asynchronous Transmitter Speed >> @ref : USART Asynchronous Transmit Speed */
 	uint16 asynchronous_tx_speed			:1;
+	/* Select the Asynchronous Transmit Speed with the lowest BAUD RATE error >> @ref : USART BAUD RATE Solver */
+	uint16 baud_rate_solver					:1;
 	/* sets the number of data bits (Character Size) in a frame the receiver and transmitter use >> @ref : uart_character_size_t */
 	uint16 char_size						:3;
 	/* enable and set type of parity generation and check >> @ref : uart_parity_mode_select_t */
@@ -151,10 +261,28 @@ typedef struct{
 	uint16 tx_buffer_reg_empty_interrupt_en	:1;
 
 	/* Reserved */
-	uint16									:3;
+	uint16									:2;
 }uart_config_t;
 
 
+#if USART_CFG_TX_DESCRIPTOR_QUEUE
+/* UART TX descriptor */
+typedef struct{
+	/* pointer to function to hold the function called in the APPLICATION layer (ISR context) when the last byte of the data is written to UDR */
+	void (* UART_TX_DoneHandler)(void);
+	/* pointer to the first byte of the data (RAM address or flash address) */
+	const uint8 *data;
+	/* number of bytes of the data */
+	uint16 length;
+	/* the memory holding the data >> @ref : UART TX Data Memory */
+	uint8 memory	:1;
+
+	/* Reserved */
+	uint8			:7;
+}uart_tx_descriptor_t;
+#endif
+
+
 /* @ref : usart_mode_select_t */
 typedef enum{
 	USART_ASYNCHRONOUS_MODE = 0,			/* USART Asynchronous Mode */
@@ -215,14 +343,17 @@ typedef enum{
  * 			7-  Selects the number of Stop Bits to be inserted by the Transmitter
  * 					- 1 Stop Bit
  * 					- 2 Stop Bits
- * 			8-  Selects the BAUD RATE value and initialize the UBRR value
+ * 			8-  Selects the BAUD RATE value and initialize the UBRR value (rounded to the nearest)
+ * 					- for the configured speed
+ * 					- for the speed with the lowest error if the BAUD RATE solver is enabled
+ * 					- solved at compile time if the static BAUD RATE is enabled
  * 			9-  Set UART RX Complete Call Back if RX Complete Interrupt is enabled
  * 			10- Set UART TX Complete Call Back if TX Complete Interrupt is enabled
  * 			11- Set UART Data Register Empty Call Back if Data Register Empty Interrupt is enabled
  * 			12- Clear UART Frame Error, Data OverRun and Parity Error
  * @param  (uart_obj) pointer to the UART object passed by reference
  * @return (l_status) status of the performed operation
- *              (E_NOT_OK)  operation failed
+ *              (E_NOT_OK)  operation failed (or the BAUD RATE error is higher than USART_BAUD_RATE_MAX_ERROR with the solver >> UCSRB isn't written)
  *              (E_OK)      operation success
  */
 Std_ReturnType UART_init(uart_config_t *uart_obj);
@@ -243,10 +374,38 @@ uint16 UART_recieveByte(void);
 
 
 /**
- * @brief  Selects the BAUD RATE value and initialize the UBRR value
+ * @brief  Selects the BAUD RATE value and initialize the UBRR value (rounded to the nearest) for the configured speed (U2X)
  * @param  (baud_rate) the value of the BAUD RATE
+ * @return the error of the generated baud rate in 0.01 % (positive >> faster than baud_rate), the UBRR isn't changed for 0 baud
  */
-void UART_setBaudRate(uint32 baud_rate);
+sint16 UART_setBaudRate(uint32 baud_rate);
+
+
+/**
+ * @brief  Selects the BAUD RATE value : evaluate both speeds (normal/double) with the rounded UBRR
+ * 			and initialize UBRR and U2X with the lowest error (normal speed on a tie)
+ * @param  (baud_rate) the value of the BAUD RATE
+ * @return the error of the generated baud rate in 0.01 % (positive >> faster than baud_rate), the UBRR isn't changed for 0 baud
+ */
+sint16 UART_setBaudRateBest(uint32 baud_rate);
+
+
+/**
+ * @brief  Set the UBRR value and the Asynchronous Transmit Speed directly (e.g. from a measured bit width)
+ * @param  (ubrr_val) the value of UBRR (0..4095)
+ * @param  (tx_speed) the Asynchronous Transmit Speed >> @ref : USART Asynchronous Transmit Speed
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType UART_setBaudRateDivider(uint16 ubrr_val , uart_tx_speed_t tx_speed);
+
+
+/**
+ * @brief  Enable/Disable the USART Receiver (disabling it flushes the receive buffer)
+ * @param  (receiver_enable) >> @ref : RXEN: Receiver Enable
+ */
+void UART_setReceiverState(uint8 receiver_enable);
 
 
 /**
@@ -269,5 +428,66 @@ Std_ReturnType UART_sendString(const uint8 * const p_str);
 Std_ReturnType UART_receiveString(uint8 * const p_str);
 
 
+#if USART_CFG_TX_RING_BUFFER
+/**
+ * @brief  Send data to another device through UART without waiting :
+ * 			1- Copy the data to the TX ring buffer (as much as its free space)
+ * 			2- Enable the USART Data Register Empty Interrupt which sends the ring
+ * @param  (p_data) pointer to the data you want to send
+ * @param  (length) number of bytes of the data
+ * @return the number of bytes copied to the ring (less than length if the ring is full, 0 if NULL pointer is passed)
+ */
+uint16 UART_write(const uint8 * const p_data , uint16 length);
+#endif
+
+
+#if USART_CFG_TX_DESCRIPTOR_QUEUE
+/**
+ * @brief  queue a descriptor of data to be sent by the USART Data Register Empty ISR (the descriptor is copied, its data is not)
+ * @param  (descriptor) pointer to the descriptor
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (the queue is full, empty data or NULL pointer is passed)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType UART_queueTx(const uart_tx_descriptor_t *descriptor);
+
+
+/**
+ * @brief  get the number of free descriptors in the TX queue (e.g. to queue all the descriptors of a frame at once)
+ * @return the number of descriptors which can be queued
+ */
+uint8 UART_getTxQueueFree(void);
+#endif
+
+
+#if USART_CFG_RX_RING_BUFFER
+/**
+ * @brief  get the number of received bytes waiting in the RX ring buffer
+ * @return the number of bytes which can be read without waiting
+ */
+uint8 UART_available(void);
+
+
+/**
+ * @brief  Receive data from another device through UART without waiting :
+ * 			move the received bytes from the RX ring buffer (as much as max_length)
+ * @param  (p_data)     pointer to the buffer to be filled with the received data
+ * @param  (max_length) size of the buffer in bytes
+ * @return the number of bytes read (0 if the ring is empty or NULL pointer is passed)
+ */
+uint16 UART_read(uint8 * const p_data , uint16 max_length);
+
+
+/**
+ * @brief  get the next received byte without removing it from the RX ring buffer
+ * @param  (p_data)   pointer to the variable to be filled with the byte
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (the ring is empty or NULL pointer is passed)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType UART_peek(uint8 * const p_data);
+#endif
+
+
 /* ----------------------------------------------------------------------------------- */
 #endif /* _USART_H_ */
@@ -0,0 +1,450 @@
+/*
+ =========================================================================================
+ Name        : autobaud.c
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : AUTOBAUD Service Source file , Ansi-style
+ =========================================================================================
+*/
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "autobaud.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/* bit cells of a frame : [START] [D0 .. D7] [STOP] */
+#define AUTOBAUD_FRAME_CELLS								10
+
+/* maximum UBRR value (12-bit Register) */
+#define AUTOBAUD_UBRR_MAX									0x0FFF
+
+/* TIMER1 Over Flows without an edge which restart a measurement (no bit cell is that long) */
+#define AUTOBAUD_TIMEOUT_OVER_FLOWS							2
+
+/* TIMER1 Over Flows counted while the line is idle (a longer idle is longer than any frame) */
+#define AUTOBAUD_IDLE_OVER_FLOWS_MAX						16
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+/* level of the line on the Input Capture Pin ICP1 (PD6) */
+#define AUTOBAUD_LINE_LEVEL()								(_PIND._PIND6)
+
+/* check if a width differs from the expected one by more than the tolerance (both scaled by the same cells) */
+#define AUTOBAUD_IS_OUT_OF_TOLERANCE(width , expected)		( ( ((width) > (expected)) ? ((width) - (expected)) : ((expected) - (width)) ) * 100UL > (expected) * AUTOBAUD_BIT_TOLERANCE_PERCENT )
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -------------------Global section-------------------- */
+
+
+#if TIMER1_MODE_SELECT == TIMER1_MODE_OVER_FLOW
+/* status of the detection */
+static volatile autobaud_status_t autobaud_status = AUTOBAUD_STATUS_IDLE;
+
+/* result of the detection */
+static autobaud_result_t autobaud_result;
+
+/* edges of the sync character frame : number of edges, bit cells of every edge interval and bit cells from the first to the last edge */
+static uint8 autobaud_edges = ZERO_INIT;
+static uint8 autobaud_interval_cells[AUTOBAUD_FRAME_CELLS - 1];
+static uint8 autobaud_total_cells = ZERO_INIT;
+
+/* measurement (used by the TIMER1 ISRs only) */
+static uint8 autobaud_edge_index = ZERO_INIT;		/* edges captured (0 >> the line is watched for a start bit) */
+static uint8 autobaud_line_high = ZERO_INIT;		/* level of the line after the last edge (TRUE >> high) */
+static uint16 autobaud_last_capture = ZERO_INIT;	/* Input Capture value of the last edge */
+static uint16 autobaud_interval_width[AUTOBAUD_FRAME_CELLS - 1];	/* edge interval widths in CPU cycles */
+static uint32 autobaud_idle_width = ZERO_INIT;		/* idle width before the start bit in CPU cycles */
+static uint32 autobaud_total_width = ZERO_INIT;		/* first to last edge width in CPU cycles */
+static uint8 autobaud_over_flows = ZERO_INIT;		/* TIMER1 Over Flows since the last edge */
+
+/* create a pointer to function to hold the address of the call back function */
+static void (* AUTOBAUD_DetectedHandler)(void) = NULL_PTR;
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+#if TIMER1_MODE_SELECT == TIMER1_MODE_OVER_FLOW
+/**
+ * @brief  TIMER1 ICU call back : capture an edge of the sync character then toggle the edge
+ */
+static void AUTOBAUD_edgeProcessing(void);
+
+
+/**
+ * @brief  TIMER1 Over Flow call back : count the idle time and restart the measurement if no edge came for too long
+ */
+static void AUTOBAUD_overFlowProcessing(void);
+
+
+/**
+ * @brief  restart the measurement : watch the line (from its current level) for the Falling edge of a start bit
+ */
+static void AUTOBAUD_restart(void);
+
+
+/**
+ * @brief  check the measured widths, select UBRR and U2X with the lowest error and configure the USART
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (the widths don't match the sync character or are out of range)
+ *              (E_OK)      operation success
+ */
+static Std_ReturnType AUTOBAUD_calculate(void);
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions definition section------------- */
+
+
+#if TIMER1_MODE_SELECT == TIMER1_MODE_OVER_FLOW
+/**
+ * @brief  start the Automatic Baud Rate Detection (the USART is initialized before by UART_init) :
+ * 			1- Disable the USART Receiver while the sync character is measured
+ * 			2- Initialize TIMER1 : clkI/O , ICU on the next edge of the line (ICP1) , ICU and Over Flow Interrupts
+ * 			3- Save the Detection Done Call Back
+ * @param  (detected_handler) called in the APPLICATION layer (ISR context) when the baud rate is found (NULL_PTR >> no call back)
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType AUTOBAUD_start(void (* detected_handler)(void))
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the configurations of TIMER1 */
+	timer1_overflow_config_t l_timer1 = {
+		.TIMER1_OVF_DefaultHandler = AUTOBAUD_overFlowProcessing,
+		.TIMER1_ICU_DefaultHandler = AUTOBAUD_edgeProcessing,
+		.clock_source = TIMER1_CLOCK_SOURCE_DIV_1,
+		.icu_edge_select = ICU_TRIGGER_FALLING_EDGE,
+		.icu_noise_canceler_enable = TIMER1_ICU_NOISE_CANCELER_ENABLE,
+		.overflow_interrupt_enable = TIMER1_OVERFLOW_INTERRUPT_ENABLE,
+		.inputcapture_interrupt_enable = TIMER1_INPUT_CAPTURE_INTERRUPT_ENABLE
+	};
+	/* create local variables to hold the bit cell and the line level of the frame */
+	uint8 l_cell = ZERO_INIT;
+	uint8 l_level = ZERO_INIT;
+	uint8 l_previous_level = ZERO_INIT;
+
+	/* --------------------------------- */
+	/* find the edges of the sync character frame (the first edge is the Falling edge of the start bit) */
+	autobaud_edges = 1;
+	autobaud_total_cells = ZERO_INIT;
+
+	for(l_cell = 1; l_cell < AUTOBAUD_FRAME_CELLS; l_cell++)
+	{
+		/* data bits are sent LSB first then the stop bit (1) */
+		l_level = (l_cell < (AUTOBAUD_FRAME_CELLS - 1)) ? ( (AUTOBAUD_SYNC_CHARACTER >> (l_cell - 1)) & 0x01 ) : 1;
+
+		if(l_level != l_previous_level)
+		{
+			/* bit cells from the previous edge */
+			autobaud_interval_cells[autobaud_edges - 1] = l_cell - autobaud_total_cells;
+
+			autobaud_total_cells = l_cell;
+			autobaud_edges++;
+		}
+		else{ /* Nothing */ }
+
+		l_previous_level = l_level;
+	}
+	/* --------------------------------- */
+
+	/* Disable the USART Receiver while the sync character is measured */
+	UART_setReceiverState(USART_RECEIVER_DISABLE);
+
+	/* Save the Detection Done Call Back */
+	AUTOBAUD_DetectedHandler = detected_handler;
+
+	autobaud_status = AUTOBAUD_STATUS_MEASURING;
+
+	/* Initialize TIMER1 then watch the line for a start bit */
+	l_status = TIMER1_OVERFLOW_init(&l_timer1);
+
+	if(E_OK == l_status)
+	{
+		AUTOBAUD_restart();
+	}
+	else{ /* Nothing */ }
+
+	return l_status;
+}
+
+
+/**
+ * @brief  stop the Automatic Baud Rate Detection : stop TIMER1 and enable the USART Receiver (the baud rate isn't changed)
+ */
+void AUTOBAUD_stop(void)
+{
+	TIMER1_OVF_deInit();
+
+	UART_setReceiverState(USART_RECEIVER_ENABLE);
+
+	if(AUTOBAUD_STATUS_MEASURING == autobaud_status)
+	{
+		autobaud_status = AUTOBAUD_STATUS_IDLE;
+	}
+	else{ /* Nothing */ }
+}
+
+
+/**
+ * @brief  get the status of the Automatic Baud Rate Detection
+ * @return the status >> @ref : autobaud_status_t
+ */
+autobaud_status_t AUTOBAUD_getStatus(void)
+{
+	return autobaud_status;
+}
+
+
+/**
+ * @brief  read the result of the Automatic Baud Rate Detection
+ * @param  (result)   pointer to the result to be filled
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (NULL pointer or the baud rate isn't found yet)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType AUTOBAUD_getResult(autobaud_result_t *result)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+
+	if( (NULL_PTR == result) || (AUTOBAUD_STATUS_DONE != autobaud_status) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		l_status = E_OK;		/* operation success */
+
+		/* the result isn't changed by the ISRs after the status is DONE */
+		*result = autobaud_result;
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  TIMER1 ICU call back : capture an edge of the sync character then toggle the edge
+ */
+static void AUTOBAUD_edgeProcessing(void)
+{
+	/* create a local variable to hold the Input Capture value of the edge */
+	uint16 l_capture = TIMER1_ICU_getInputCaptureValue();
+	/* create a local variable to hold the width from the last edge (the 16-bit subtraction handles the Over Flow) */
+	uint16 l_width = (uint16)(l_capture - autobaud_last_capture);
+	/* create a local variable to hold the TIMER1 Over Flows counted since the last edge (the one of a wrapped width isn't a full 65536) */
+	uint8 l_over_flows = autobaud_over_flows - ( ((l_capture < autobaud_last_capture) && (autobaud_over_flows != ZERO_INIT)) ? 1 : 0 );
+
+	autobaud_last_capture = l_capture;
+	autobaud_over_flows = ZERO_INIT;
+
+	/* the edges alternate : the next edge after a Falling edge is Rising */
+	autobaud_line_high = autobaud_line_high ? FALSE : TRUE;
+	TIMER1_ICU_setEdgeDetectionType( autobaud_line_high ? ICU_TRIGGER_FALLING_EDGE : ICU_TRIGGER_RISING_EDGE );
+
+	/* --------------------------------- */
+	/* edge of the frame */
+	if(autobaud_edge_index != ZERO_INIT)
+	{
+		/* the interval ended by this edge */
+		autobaud_interval_width[autobaud_edge_index - 1] = l_width;
+		autobaud_total_width += l_width;
+		autobaud_edge_index++;
+
+		if( AUTOBAUD_IS_OUT_OF_TOLERANCE( (uint32)l_width * autobaud_interval_cells[0] ,
+										  (uint32)autobaud_interval_width[0] * autobaud_interval_cells[autobaud_edge_index - 2] ) )
+		{
+			/* the interval doesn't match the start bit (not the sync character, noise or the frame started inside another one)
+			   >> watch the line again from this edge */
+			autobaud_edge_index = ZERO_INIT;
+		}
+		else if(autobaud_edge_index == autobaud_edges)
+		{
+			/* last edge of the frame */
+			if(E_OK == AUTOBAUD_calculate())
+			{
+				/* the baud rate is found : stop TIMER1 and receive with the new baud rate */
+				TIMER1_OVF_deInit();
+				UART_setReceiverState(USART_RECEIVER_ENABLE);
+				autobaud_status = AUTOBAUD_STATUS_DONE;
+
+				if(AUTOBAUD_DetectedHandler)
+				{
+					/* Call Back */
+					(*AUTOBAUD_DetectedHandler)();
+				}
+				else{ /* Nothing */ }
+			}
+			else
+			{
+				/* not the sync character or noise >> watch the line again from this edge (Rising edge of the stop bit) */
+				autobaud_edge_index = ZERO_INIT;
+			}
+		}
+		else{ /* Nothing */ }
+	}
+	else{ /* Nothing */ }
+	/* --------------------------------- */
+
+	/* --------------------------------- */
+	/* Falling edge while the line is watched >> start bit : keep the idle width (line high) before it */
+	if( (ZERO_INIT == autobaud_edge_index) && (FALSE == autobaud_line_high) )
+	{
+		autobaud_idle_width = ((uint32)l_over_flows << 16) + l_width;
+		autobaud_total_width = ZERO_INIT;
+		autobaud_edge_index = 1;
+	}
+	else{ /* Nothing */ }
+	/* --------------------------------- */
+}
+
+
+/**
+ * @brief  TIMER1 Over Flow call back : count the idle time and restart the measurement if no edge came for too long
+ */
+static void AUTOBAUD_overFlowProcessing(void)
+{
+	if(autobaud_edge_index != ZERO_INIT)
+	{
+		autobaud_over_flows++;
+
+		if(autobaud_over_flows >= AUTOBAUD_TIMEOUT_OVER_FLOWS)
+		{
+			AUTOBAUD_restart();
+		}
+		else{ /* Nothing */ }
+	}
+	else if(autobaud_over_flows < AUTOBAUD_IDLE_OVER_FLOWS_MAX)
+	{
+		/* the line is watched for a start bit */
+		autobaud_over_flows++;
+	}
+	else{ /* Nothing */ }
+}
+
+
+/**
+ * @brief  restart the measurement : watch the line (from its current level) for the Falling edge of a start bit
+ */
+static void AUTOBAUD_restart(void)
+{
+	autobaud_edge_index = ZERO_INIT;
+	autobaud_over_flows = ZERO_INIT;
+
+	/* the idle time is counted from now if the line is high, else from its next Rising edge */
+	autobaud_last_capture = _TCNT1.TwoBytes;
+	autobaud_line_high = AUTOBAUD_LINE_LEVEL() ? TRUE : FALSE;
+
+	TIMER1_ICU_setEdgeDetectionType( autobaud_line_high ? ICU_TRIGGER_FALLING_EDGE : ICU_TRIGGER_RISING_EDGE );
+}
+
+
+/**
+ * @brief  check the measured widths, select UBRR and U2X with the lowest error and configure the USART
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (the widths don't match the sync character or are out of range)
+ *              (E_OK)      operation success
+ */
+static Std_ReturnType AUTOBAUD_calculate(void)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = E_OK;
+	/* create local variables to hold an edge interval width and the expected one (both scaled by the cells) */
+	uint32 l_width = ZERO_INIT;
+	uint32 l_expected = ZERO_INIT;
+	/* create a local variable to traverse the edge intervals */
+	uint8 l_interval = ZERO_INIT;
+	/* create local variables to hold the divisors (UBRR + 1) and their errors in CPU cycles over the measured cells */
+	uint32 l_normal = ZERO_INIT;
+	uint32 l_double = ZERO_INIT;
+	uint32 l_normal_error = ZERO_INIT;
+	uint32 l_double_error = ZERO_INIT;
+	/* create a local variable to hold the bit cells in CPU cycles (16 or 8 per divisor) */
+	uint32 l_cells = ZERO_INIT;
+
+	/* --------------------------------- */
+	/* the line must be idle for one frame at least before the start bit (idle x cells >= total x frame cells) */
+	if( (autobaud_idle_width * autobaud_total_cells) < (autobaud_total_width * AUTOBAUD_FRAME_CELLS) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else{ /* Nothing */ }
+
+	/* every edge interval must match its bit cells times the mean bit cell of the frame */
+	for(l_interval = ZERO_INIT; (E_OK == l_status) && (l_interval < (autobaud_edges - 1)); l_interval++)
+	{
+		l_width = (uint32)autobaud_interval_width[l_interval] * autobaud_total_cells;
+		l_expected = autobaud_total_width * autobaud_interval_cells[l_interval];
+
+		if( AUTOBAUD_IS_OUT_OF_TOLERANCE(l_width , l_expected) )
+		{
+			l_status = E_NOK;		/* operation failed */
+		}
+		else{ /* Nothing */ }
+	}
+	/* --------------------------------- */
+
+	/* --------------------------------- */
+	/* rounded divisors : bit cell = 16 * (UBRR + 1) CPU cycles (Normal Speed) or 8 * (UBRR + 1) (Double Speed) */
+	l_cells = (uint32)autobaud_total_cells * 16;
+	l_normal = (autobaud_total_width + (l_cells / 2)) / l_cells;
+	l_normal_error = l_normal * l_cells;
+	l_normal_error = (l_normal_error > autobaud_total_width) ? (l_normal_error - autobaud_total_width) : (autobaud_total_width - l_normal_error);
+
+	l_cells = (uint32)autobaud_total_cells * 8;
+	l_double = (autobaud_total_width + (l_cells / 2)) / l_cells;
+	l_double_error = l_double * l_cells;
+	l_double_error = (l_double_error > autobaud_total_width) ? (l_double_error - autobaud_total_width) : (autobaud_total_width - l_double_error);
+
+	/* Normal Speed samples each bit more times so it's selected unless Double Speed has a lower error */
+	if(E_NOK == l_status)
+	{
+		/* Nothing */
+	}
+	else if( (l_normal != 0) && ( (l_normal - 1) <= AUTOBAUD_UBRR_MAX ) && (l_normal_error <= l_double_error) )
+	{
+		autobaud_result.ubrr_value = (uint16)(l_normal - 1);
+		autobaud_result.tx_speed = UART_NORMAL_SPEED_MODE;
+	}
+	else if( (l_double != 0) && ( (l_double - 1) <= AUTOBAUD_UBRR_MAX ) )
+	{
+		autobaud_result.ubrr_value = (uint16)(l_double - 1);
+		autobaud_result.tx_speed = UART_DOUBLE_SPEED_MODE;
+	}
+	else
+	{
+		/* the bit cell is out of the USART range */
+		l_status = E_NOK;		/* operation failed */
+	}
+	/* --------------------------------- */
+
+	if(E_OK == l_status)
+	{
+		/* measured baud rate = F_CPU * cells / CPU cycles of the cells */
+		autobaud_result.baud_rate = ( (CPU_FREQUENCY * autobaud_total_cells) + (autobaud_total_width / 2) ) / autobaud_total_width;
+
+		l_status = UART_setBaudRateDivider(autobaud_result.ubrr_value , (uart_tx_speed_t)autobaud_result.tx_speed);
+	}
+	else{ /* Nothing */ }
+
+	return l_status;
+}
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
@@ -0,0 +1,124 @@
+/*
+ =========================================================================================
+ Name        : autobaud.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : AUTOBAUD Service Header file , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _AUTOBAUD_H_
+#define _AUTOBAUD_H_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "usart.h"
+#include "timer1.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * Automatic Baud Rate Detection Service :
+ * 	- the remote device sends the sync character (repeated till it gets an answer), the TIMER1 ICU captures
+ * 	  every edge of its frame ( [START] [D0 .. D7] [STOP] ) at clkI/O so the widths are counted in CPU cycles
+ * 	- the frame is accepted only if the line was idle (high) for at least one frame (at the measured baud rate)
+ * 	  before its start bit, so a Falling edge inside a frame isn't taken as a start bit : the remote device must
+ * 	  leave the line idle for one frame or more between two sync characters
+ * 	- every edge interval is checked against its bit cells in the sync character times the mean bit-cell width
+ * 	  of the whole frame (noise and wrong characters are rejected and the detection restarts), then UBRR and
+ * 	  U2X with the lowest error are written to the USART and the receiver is enabled again
+ * 	- HARDWARE : the ICU only listens to ICP1 (PD6) so RXD (PD0) must be wired to ICP1
+ * 	- TIMER1 is used by the detection only (it's stopped when the baud rate is found or AUTOBAUD_stop is called)
+ * 	- range : a bit cell from about 120 CPU cycles (the ISR must handle an edge before the next one,
+ * 	  about 66000 baud at 8 MHz) to 65535 CPU cycles
+ */
+
+/* --------------------------------- */
+/* sync character sent by the remote device (0x55 'U' >> an edge on every bit cell) */
+
+#define AUTOBAUD_SYNC_CHARACTER								0x55
+
+/* --------------------------------- */
+/* maximum difference between an edge interval and its expected width (bit cells x mean bit-cell width) in percent */
+
+#define AUTOBAUD_BIT_TOLERANCE_PERCENT						25
+
+/* --------------------------------- */
+
+#if ( AUTOBAUD_SYNC_CHARACTER == 0xFF )
+#error "AUTOBAUD_SYNC_CHARACTER must have at least one zero data bit"
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -----user_defined data type declaration section------ */
+#if TIMER1_MODE_SELECT == TIMER1_MODE_OVER_FLOW
+
+/* @ref : autobaud_status_t */
+typedef enum{
+	AUTOBAUD_STATUS_IDLE = 0,					/* no detection is running */
+	AUTOBAUD_STATUS_MEASURING,					/* waiting for the sync character */
+	AUTOBAUD_STATUS_DONE						/* the baud rate is found and the USART is configured */
+}autobaud_status_t;
+
+/* Automatic Baud Rate Detection result */
+typedef struct{
+	/* the measured BAUD RATE */
+	uint32 baud_rate;
+	/* the UBRR value written to the USART */
+	uint16 ubrr_value;
+	/* the Asynchronous Transmit Speed written to the USART >> @ref : USART Asynchronous Transmit Speed */
+	uint8 tx_speed;
+}autobaud_result_t;
+
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+#if TIMER1_MODE_SELECT == TIMER1_MODE_OVER_FLOW
+/**
+ * @brief  start the Automatic Baud Rate Detection (the USART is initialized before by UART_init) :
+ * 			1- Disable the USART Receiver while the sync character is measured
+ * 			2- Initialize TIMER1 : clkI/O , ICU on the next edge of the line (ICP1) , ICU and Over Flow Interrupts
+ * 			3- Save the Detection Done Call Back
+ * @param  (detected_handler) called in the APPLICATION layer (ISR context) when the baud rate is found (NULL_PTR >> no call back)
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType AUTOBAUD_start(void (* detected_handler)(void));
+
+
+/**
+ * @brief  stop the Automatic Baud Rate Detection : stop TIMER1 and enable the USART Receiver (the baud rate isn't changed)
+ */
+void AUTOBAUD_stop(void);
+
+
+/**
+ * @brief  get the status of the Automatic Baud Rate Detection
+ * @return the status >> @ref : autobaud_status_t
+ */
+autobaud_status_t AUTOBAUD_getStatus(void);
+
+
+/**
+ * @brief  read the result of the Automatic Baud Rate Detection
+ * @param  (result)   pointer to the result to be filled
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (NULL pointer or the baud rate isn't found yet)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType AUTOBAUD_getResult(autobaud_result_t *result);
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _AUTOBAUD_H_ */
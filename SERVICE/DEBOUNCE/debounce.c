@@ -0,0 +1,223 @@
+/*
+ =========================================================================================
+ Name        : debounce.c
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : DEBOUNCE Service Source file , Ansi-style
+ =========================================================================================
+*/
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "debounce.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -------------------Global section-------------------- */
+
+/* debounced logic of the pins of every port */
+static volatile uint8 debounce_state[PORT_MAX];
+
+/* vertical counters of every port (bit (x) of counter0/counter1 are the 2-bit counter of pin (x)) */
+static uint8 debounce_counter0[PORT_MAX];
+static uint8 debounce_counter1[PORT_MAX];
+
+/* pressed/released edges of every port latched until they are read */
+static volatile uint8 debounce_press[PORT_MAX];
+static volatile uint8 debounce_release[PORT_MAX];
+
+/* active low pins of every port (the bytes of DEBOUNCE_ACTIVE_LOW_PINS computed at compile time) */
+static const uint8 debounce_active_low[PORT_MAX] = {	(uint8)( DEBOUNCE_ACTIVE_LOW_PINS >> (0 * DEBOUNCE_PORT_BITS) ) ,
+														(uint8)( DEBOUNCE_ACTIVE_LOW_PINS >> (1 * DEBOUNCE_PORT_BITS) ) ,
+														(uint8)( DEBOUNCE_ACTIVE_LOW_PINS >> (2 * DEBOUNCE_PORT_BITS) ) ,
+														(uint8)( DEBOUNCE_ACTIVE_LOW_PINS >> (3 * DEBOUNCE_PORT_BITS) )
+													};
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  update the vertical counters, debounced state and press/release edges of one port
+ * @param  (port)        	the port ID >> @ref : GPIO_PORTx
+ * @param  (sample)      	the logic of the PINx Register of the port sampled in this tick
+ * @param  (active_low)  	the active low pins of the port
+ */
+static void DEBOUNCE_tickPort(uint8 port , uint8 sample , uint8 active_low);
+
+
+/**
+ * @brief  pack 4 port bytes in one 32-bit image (port A is the least significant byte)
+ * @param  (ports)  pointer to the first byte of the 4 port bytes
+ * @return the 32-bit image
+ */
+static uint32 DEBOUNCE_packPorts(const volatile uint8 *ports);
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions definition section------------- */
+
+
+/**
+ * @brief  initialize the Debounce Service :
+ * 				1- Take the current logic of all the inputs as the debounced state
+ * 				2- Clear the vertical counters and the press/release edges
+ */
+void DEBOUNCE_init(void)
+{
+	/* create a local variable to traverse the ports */
+	uint8 l_port = ZERO_INIT;
+
+	for(l_port = 0; l_port < PORT_MAX; l_port++)
+	{
+		debounce_state[l_port] = GPIO_PIN_REG(l_port);
+		debounce_counter0[l_port] = ZERO_INIT;
+		debounce_counter1[l_port] = ZERO_INIT;
+		debounce_press[l_port] = ZERO_INIT;
+		debounce_release[l_port] = ZERO_INIT;
+	}
+}
+
+
+/**
+ * @brief  sample all the inputs and update their vertical counters, debounced state and press/release edges
+ * 			(to be called periodically, from a Timer call back or from the main loop)
+ */
+void DEBOUNCE_tick(void)
+{
+	/* every PINx Register is read at its constant address with the constant active low pins of its port */
+	DEBOUNCE_tickPort( GPIO_PORTA , GPIO_PIN_REG(GPIO_PORTA) , debounce_active_low[GPIO_PORTA] );
+	DEBOUNCE_tickPort( GPIO_PORTB , GPIO_PIN_REG(GPIO_PORTB) , debounce_active_low[GPIO_PORTB] );
+	DEBOUNCE_tickPort( GPIO_PORTC , GPIO_PIN_REG(GPIO_PORTC) , debounce_active_low[GPIO_PORTC] );
+	DEBOUNCE_tickPort( GPIO_PORTD , GPIO_PIN_REG(GPIO_PORTD) , debounce_active_low[GPIO_PORTD] );
+}
+
+
+/**
+ * @brief  get the debounced logic of all the inputs
+ * @return the debounced 32-bit image of PINA..PIND (PINA is the least significant byte)
+ */
+uint32 DEBOUNCE_getState(void)
+{
+	/* create a local variable to hold the Status Register */
+	uint8 l_sreg = ZERO_INIT;
+	/* create a local variable to hold the debounced image */
+	uint32 l_state = ZERO_INIT;
+
+	/* disable the interrupts so DEBOUNCE_tick can't update the state while it's read */
+	CRITICAL_SECTION_ENTER(l_sreg);
+	l_state = DEBOUNCE_packPorts(debounce_state);
+	CRITICAL_SECTION_EXIT(l_sreg);
+
+	return l_state;
+}
+
+
+/**
+ * @brief  get the inputs which are pressed since the last call and clear them
+ * @return the 32-bit mask of the pressed inputs (bit = 1 >> the input is pressed)
+ */
+uint32 DEBOUNCE_getPressEdges(void)
+{
+	/* create a local variable to hold the Status Register */
+	uint8 l_sreg = ZERO_INIT;
+	/* create a local variable to hold the pressed edges */
+	uint32 l_edges = ZERO_INIT;
+	/* create a local variable to traverse the ports */
+	uint8 l_port = ZERO_INIT;
+
+	/* disable the interrupts so DEBOUNCE_tick can't latch an edge between the read and the clear */
+	CRITICAL_SECTION_ENTER(l_sreg);
+	l_edges = DEBOUNCE_packPorts(debounce_press);
+	for(l_port = 0; l_port < PORT_MAX; l_port++)
+	{
+		debounce_press[l_port] = ZERO_INIT;
+	}
+	CRITICAL_SECTION_EXIT(l_sreg);
+
+	return l_edges;
+}
+
+
+/**
+ * @brief  get the inputs which are released since the last call and clear them
+ * @return the 32-bit mask of the released inputs (bit = 1 >> the input is released)
+ */
+uint32 DEBOUNCE_getReleaseEdges(void)
+{
+	/* create a local variable to hold the Status Register */
+	uint8 l_sreg = ZERO_INIT;
+	/* create a local variable to hold the released edges */
+	uint32 l_edges = ZERO_INIT;
+	/* create a local variable to traverse the ports */
+	uint8 l_port = ZERO_INIT;
+
+	/* disable the interrupts so DEBOUNCE_tick can't latch an edge between the read and the clear */
+	CRITICAL_SECTION_ENTER(l_sreg);
+	l_edges = DEBOUNCE_packPorts(debounce_release);
+	for(l_port = 0; l_port < PORT_MAX; l_port++)
+	{
+		debounce_release[l_port] = ZERO_INIT;
+	}
+	CRITICAL_SECTION_EXIT(l_sreg);
+
+	return l_edges;
+}
+
+
+/**
+ * @brief  update the vertical counters, debounced state and press/release edges of one port
+ * @param  (port)        	the port ID >> @ref : GPIO_PORTx
+ * @param  (sample)      	the logic of the PINx Register of the port sampled in this tick
+ * @param  (active_low)  	the active low pins of the port
+ */
+static void DEBOUNCE_tickPort(uint8 port , uint8 sample , uint8 active_low)
+{
+	/* create a local variable to hold the pins which are sampled with a logic different from their debounced state */
+	uint8 l_delta = ZERO_INIT;
+	/* create a local variable to hold the pins which changed their debounced state in this tick */
+	uint8 l_toggle = ZERO_INIT;
+	/* create a local variable to hold the pins which are pressed after this tick */
+	uint8 l_active = ZERO_INIT;
+
+	/* get the pins differing from the debounced state */
+	l_delta = sample ^ debounce_state[port];
+
+	/*
+	 * vertical counters :
+	 * 	- the counter of a pin is cleared whenever its sample is equal to its debounced state
+	 * 	- otherwise it counts 00 >> 01 >> 10 >> 11 >> 00, the debounced state toggles when it rolls over to 00
+	 */
+	debounce_counter1[port] = (debounce_counter1[port] ^ debounce_counter0[port]) & l_delta;
+	debounce_counter0[port] = (uint8)(~debounce_counter0[port]) & l_delta;
+	l_toggle = l_delta & (uint8)( ~(debounce_counter0[port] | debounce_counter1[port]) );
+
+	/* update the debounced state */
+	debounce_state[port] ^= l_toggle;
+
+	/* latch the pressed/released edges */
+	l_active = debounce_state[port] ^ active_low;
+	debounce_press[port] |= l_toggle & l_active;
+	debounce_release[port] |= l_toggle & (uint8)(~l_active);
+}
+
+
+/**
+ * @brief  pack 4 port bytes in one 32-bit image (port A is the least significant byte)
+ * @param  (ports)  pointer to the first byte of the 4 port bytes
+ * @return the 32-bit image
+ */
+static uint32 DEBOUNCE_packPorts(const volatile uint8 *ports)
+{
+	return ( ( (uint32)ports[GPIO_PORTD] << (3 * DEBOUNCE_PORT_BITS) ) |
+			 ( (uint32)ports[GPIO_PORTC] << (2 * DEBOUNCE_PORT_BITS) ) |
+			 ( (uint32)ports[GPIO_PORTB] << (1 * DEBOUNCE_PORT_BITS) ) |
+			 ( (uint32)ports[GPIO_PORTA] ) );
+}
+
+
+/* ----------------------------------------------------------------------------------- */
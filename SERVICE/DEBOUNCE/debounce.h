@@ -0,0 +1,94 @@
+/*
+ =========================================================================================
+ Name        : debounce.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : DEBOUNCE Service Header file , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _DEBOUNCE_H_
+#define _DEBOUNCE_H_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "gpio.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * Debounce Service :
+ * 	- DEBOUNCE_tick samples PINA..PIND and runs a 2-bit vertical counter for every one of the 32 inputs
+ * 	  (all the 8 pins of a port are counted in parallel by a few logic operations on 3 bytes)
+ * 	- an input changes its debounced state only after it is sampled with the new logic in 4 successive ticks
+ * 	- DEBOUNCE_tick must be called periodically (e.g. every 5ms from a Timer call back) so the debounce time is 4 ticks
+ * 	- pin (x) of port (y) is bit (8 * y + x) in all the 32-bit images >> @ref : gpio port index / gpio pin index
+ */
+
+/* --------------------------------- */
+/* pins which are pressed when their logic is LOW (button to GND with pull up resistance) */
+/* NOTE: bit = 1 >> pressed when LOW, bit = 0 >> pressed when HIGH */
+
+#define DEBOUNCE_ACTIVE_LOW_PINS			0xFFFFFFFFUL
+
+/* --------------------------------- */
+/* number of bits of a port in the 32-bit images */
+
+#define DEBOUNCE_PORT_BITS					GPIO_PORT_BITS
+
+/* --------------------------------- */
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+/* bit of a pin in the 32-bit images (same layout as the GPIO input vector) */
+#define DEBOUNCE_PIN_MASK(PORT,PIN)			GPIO_INPUT_MASK(PORT,PIN)
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  initialize the Debounce Service :
+ * 				1- Take the current logic of all the inputs as the debounced state
+ * 				2- Clear the vertical counters and the press/release edges
+ */
+void DEBOUNCE_init(void);
+
+
+/**
+ * @brief  sample all the inputs and update their vertical counters, debounced state and press/release edges
+ * 			(to be called periodically, from a Timer call back or from the main loop)
+ */
+void DEBOUNCE_tick(void);
+
+
+/**
+ * @brief  get the debounced logic of all the inputs
+ * @return the debounced 32-bit image of PINA..PIND (PINA is the least significant byte)
+ */
+uint32 DEBOUNCE_getState(void);
+
+
+/**
+ * @brief  get the inputs which are pressed since the last call and clear them
+ * @return the 32-bit mask of the pressed inputs (bit = 1 >> the input is pressed)
+ */
+uint32 DEBOUNCE_getPressEdges(void);
+
+
+/**
+ * @brief  get the inputs which are released since the last call and clear them
+ * @return the 32-bit mask of the released inputs (bit = 1 >> the input is released)
+ */
+uint32 DEBOUNCE_getReleaseEdges(void);
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _DEBOUNCE_H_ */
@@ -0,0 +1,290 @@
+/*
+ =========================================================================================
+ Name        : logic_analyzer.c
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : LOGIC ANALYZER Service Source file , Ansi-style
+ =========================================================================================
+*/
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "logic_analyzer.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/* TOV1 flag in the Timer/Counter Interrupt Flag Register (cleared by writing a logical one) */
+#define LOGIC_ANALYZER_TOV1_FLAG_MASK						0x04
+
+/* Timer1 flags in the Timer/Counter Interrupt Flag Register (TOV1, OCF1B, OCF1A and ICF1) */
+#define LOGIC_ANALYZER_TIMER1_FLAGS_MASK					0x3C
+
+/* most significant bit of TCNT1 */
+#define LOGIC_ANALYZER_TCNT1_MSB_MASK						0x8000
+
+/* TCNT1 one tick before the overflow */
+#define LOGIC_ANALYZER_TCNT1_MAX							0xFFFF
+
+/* the ring buffer index wraps with a mask */
+#if (LOGIC_ANALYZER_BUFFER_SIZE & (LOGIC_ANALYZER_BUFFER_SIZE - 1)) != 0
+#error "LOGIC_ANALYZER_BUFFER_SIZE must be a power of 2"
+#endif
+
+#define LOGIC_ANALYZER_INDEX_MASK							(LOGIC_ANALYZER_BUFFER_SIZE - 1)
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -------------------Global section-------------------- */
+
+/* ring buffer of the records */
+static logic_analyzer_record_t logic_analyzer_records[LOGIC_ANALYZER_BUFFER_SIZE];
+
+/* index of the next record to be written */
+static uint16 logic_analyzer_head = ZERO_INIT;
+
+/* number of the valid records in the ring buffer */
+static uint16 logic_analyzer_count = ZERO_INIT;
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions definition section------------- */
+
+
+/**
+ * @brief  capture the changes of the sampled pins :
+ * 			1- Save Timer1 control registers, TCNT1 and flags then run Timer1 in Normal Mode
+ * 			2- Record the initial state of the pins
+ * 			3- Sample the pins in a polled loop with the interrupts disabled and record every change with its timestamp
+ * 			4- End the capture after the required duration (or when the buffer is full if required)
+ * 			5- Restore Timer1 control registers, TCNT1 and flags and the interrupts
+ * @param  (la_obj)   pointer to the Logic Analyzer object passed by reference
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (or duration_overflows is higher than LOGIC_ANALYZER_MAX_DURATION_OVERFLOWS)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType LOGIC_ANALYZER_capture(const logic_analyzer_config_t *la_obj)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the Status Register */
+	uint8 l_sreg = ZERO_INIT;
+	/* create local variables to hold Timer1 control registers */
+	uint8 l_tccr1a = ZERO_INIT;
+	uint8 l_tccr1b = ZERO_INIT;
+	/* create local variables to hold Timer1 counter and its pending flags */
+	uint16 l_tcnt1 = ZERO_INIT;
+	uint8 l_tifr = ZERO_INIT;
+	/* create a local pointer to hold the Input Pins Register of the sampled port */
+	volatile uint8 *l_pin_reg = NULL_PTR;
+	/* create local variables to hold the sampled pins and their last recorded state */
+	uint8 l_mask = ZERO_INIT;
+	uint8 l_sample = ZERO_INIT;
+	uint8 l_last = ZERO_INIT;
+	/* create local variables to hold the timestamp of the sample */
+	uint16 l_timestamp = ZERO_INIT;
+	uint16 l_high = ZERO_INIT;
+	/* create a local variable to hold the Timer1 overflows since the capture started */
+	uint16 l_overflows = ZERO_INIT;
+	/* create local variables to hold the ring buffer state (kept in registers inside the loop) */
+	uint16 l_head = ZERO_INIT;
+	uint16 l_count = ZERO_INIT;
+
+	/* check if the address is valid or not */
+	/* check if no pin is sampled */
+	/* check if the interrupt blackout of the capture is too long */
+	if( (NULL_PTR == la_obj) || (GPIO_PORT_MASK_ALL_CLEAR == la_obj->pins_mask) ||
+		(la_obj->duration_overflows > LOGIC_ANALYZER_MAX_DURATION_OVERFLOWS) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		l_status = E_OK;		/* operation success */
+
+		l_pin_reg = &GPIO_PIN_REG(la_obj->port);
+		l_mask = la_obj->pins_mask;
+
+		/* disable the interrupts so no ISR steals cycles from the sampling loop or clears TOV1
+		   (the blackout is limited by LOGIC_ANALYZER_MAX_DURATION_OVERFLOWS) */
+		CRITICAL_SECTION_ENTER(l_sreg);
+
+		/* --------------------------------- */
+		/* Save Timer1 (its clock is stopped first so TCNT1 is frozen) then run Timer1 in Normal Mode from zero */
+		l_tccr1b = _TCCR1B.Byte;
+		_TCCR1B.Byte = ZERO_INIT;
+		l_tccr1a = _TCCR1A.Byte;
+		l_tcnt1 = _TCNT1.TwoBytes;
+		l_tifr = _TIFR.Byte & LOGIC_ANALYZER_TIMER1_FLAGS_MASK;
+
+		_TCCR1A.Byte = ZERO_INIT;
+		_TCNT1.TwoBytes = ZERO_INIT;
+		_TIFR.Byte = LOGIC_ANALYZER_TOV1_FLAG_MASK;
+		TIMER1_ENABLE(LOGIC_ANALYZER_TIMER_CLOCK);
+		/* --------------------------------- */
+
+		/* --------------------------------- */
+		/* Record the initial state of the pins */
+		l_last = *l_pin_reg & l_mask;
+		logic_analyzer_records[l_head].timestamp_high = ZERO_INIT;
+		logic_analyzer_records[l_head].timestamp_low = ZERO_INIT;
+		logic_analyzer_records[l_head].state = l_last;
+		l_head = (l_head + 1) & LOGIC_ANALYZER_INDEX_MASK;
+		l_count = 1;
+		/* --------------------------------- */
+
+		/* --------------------------------- */
+		/* Sampling loop */
+		while(l_overflows < la_obj->duration_overflows)
+		{
+			/* sample the pins then take the timestamp */
+			l_sample = *l_pin_reg & l_mask;
+			l_timestamp = _TCNT1.TwoBytes;
+			l_high = l_overflows;
+
+			/* extend the timestamp with the overflows */
+			if(_TIFR._TOV1)
+			{
+				_TIFR.Byte = LOGIC_ANALYZER_TOV1_FLAG_MASK;
+				l_overflows++;
+
+				/* a small timestamp means the overflow occurred before TCNT1 was read */
+				if( !(l_timestamp & LOGIC_ANALYZER_TCNT1_MSB_MASK) )
+				{
+					l_high = l_overflows;
+				}
+				else{ /* Nothing */ }
+			}
+			else{ /* Nothing */ }
+
+			/* record the change */
+			if(l_sample != l_last)
+			{
+				l_last = l_sample;
+
+				logic_analyzer_records[l_head].timestamp_high = l_high;
+				logic_analyzer_records[l_head].timestamp_low = l_timestamp;
+				logic_analyzer_records[l_head].state = l_sample;
+				l_head = (l_head + 1) & LOGIC_ANALYZER_INDEX_MASK;
+
+				if(l_count < LOGIC_ANALYZER_BUFFER_SIZE)
+				{
+					l_count++;
+				}
+				else{ /* the oldest record is overwritten */ }
+
+				if( (LOGIC_ANALYZER_STOP_WHEN_FULL == la_obj->buffer_full_action) && (LOGIC_ANALYZER_BUFFER_SIZE == l_count) )
+				{
+					break;
+				}
+				else{ /* Nothing */ }
+			}
+			else{ /* Nothing */ }
+		}
+		/* --------------------------------- */
+
+		/* --------------------------------- */
+		/* Restore Timer1 (stop the clock first) */
+		TIMER1_DISABLE();
+
+		/* TOV1 can't be set by software, a TOV1 pending before the capture is raised again by one overflow */
+		if(l_tifr & LOGIC_ANALYZER_TOV1_FLAG_MASK)
+		{
+			_TCNT1.TwoBytes = LOGIC_ANALYZER_TCNT1_MAX;
+			TIMER1_ENABLE(TIMER1_CLOCK_SOURCE_DIV_1);
+			while( !(_TIFR._TOV1) );
+			TIMER1_DISABLE();
+		}
+		else{ /* Nothing */ }
+
+		/* clear the Timer1 flags raised by the capture (the flags pending before the capture are kept) */
+		_TIFR.Byte = (uint8)( ~l_tifr & LOGIC_ANALYZER_TIMER1_FLAGS_MASK );
+
+		_TCNT1.TwoBytes = l_tcnt1;
+		_TCCR1A.Byte = l_tccr1a;
+		_TCCR1B.Byte = l_tccr1b;
+		/* --------------------------------- */
+
+		CRITICAL_SECTION_EXIT(l_sreg);
+
+		logic_analyzer_head = l_head;
+		logic_analyzer_count = l_count;
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  get the number of records of the last capture
+ * @return number of records
+ */
+uint16 LOGIC_ANALYZER_getRecordsCount(void)
+{
+	return logic_analyzer_count;
+}
+
+
+/**
+ * @brief  get a record of the last capture (index 0 is the oldest record)
+ * @param  (index)    index of the record
+ * @param  (record)   pointer to the record to be filled
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType LOGIC_ANALYZER_getRecord(uint16 index , logic_analyzer_record_t *record)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+
+	if( (NULL_PTR == record) || (index >= logic_analyzer_count) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		l_status = E_OK;		/* operation success */
+
+		/* the oldest record is (count) records behind the head */
+		*record = logic_analyzer_records[(logic_analyzer_head - logic_analyzer_count + index) & LOGIC_ANALYZER_INDEX_MASK];
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  send the records of the last capture through UART (UART must be initialized)
+ */
+void LOGIC_ANALYZER_stream(void)
+{
+	/* create a local variable to traverse the records */
+	uint16 l_index = ZERO_INIT;
+	/* create a local variable to hold the record to be sent */
+	logic_analyzer_record_t l_record;
+
+	/* header */
+	UART_sendByte(LOGIC_ANALYZER_STREAM_SYNC);
+	UART_sendByte( (uint8)logic_analyzer_count );
+	UART_sendByte( (uint8)(logic_analyzer_count >> 8) );
+
+	/* records from the oldest to the newest */
+	for(l_index = 0; l_index < logic_analyzer_count; l_index++)
+	{
+		LOGIC_ANALYZER_getRecord(l_index , &l_record);
+
+		UART_sendByte(l_record.state);
+		UART_sendByte( (uint8)l_record.timestamp_low );
+		UART_sendByte( (uint8)(l_record.timestamp_low >> 8) );
+		UART_sendByte( (uint8)l_record.timestamp_high );
+		UART_sendByte( (uint8)(l_record.timestamp_high >> 8) );
+	}
+}
+
+
+/* ----------------------------------------------------------------------------------- */
@@ -0,0 +1,148 @@
+/*
+ =========================================================================================
+ Name        : logic_analyzer.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : LOGIC ANALYZER Service Header file , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _LOGIC_ANALYZER_H_
+#define _LOGIC_ANALYZER_H_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "gpio.h"
+#include "timer1.h"
+#include "usart.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * Logic Analyzer Service :
+ * 	- LOGIC_ANALYZER_capture samples up to 8 pins of one port in a polled loop with the interrupts disabled
+ * 	  (no ISR overhead, ~15 cycles per sample when nothing changes >> far above 100 kHz at 8 MHz)
+ * 	- every change of the sampled pins is recorded in a RAM ring buffer with a 32-bit timestamp :
+ * 		- low word  : TCNT1 (Timer1 runs in Normal Mode during the capture)
+ * 		- high word : Timer1 overflows counted by polling TOV1
+ * 	- the first record holds the state of the pins when the capture starts
+ * 	- INTERRUPT BLACKOUT : the global interrupts are disabled for the whole capture, that is up to
+ * 	  duration_overflows x 65536 Timer1 ticks (8.2 ms per overflow at 8 MHz with DIV_1) :
+ * 		- every ISR is delayed till the capture ends and an interrupt flag raised twice in the blackout is served once
+ * 		- the USART receives 2 bytes plus the one in its shift register, the next bytes are lost (Data OverRun)
+ * 		- the time kept by ISRs (ticks, timeouts, software timers) falls behind by the capture duration
+ * 	  so the capture is refused if duration_overflows is higher than LOGIC_ANALYZER_MAX_DURATION_OVERFLOWS
+ * 	- Timer1 is owned by the capture while it runs, its control registers, TCNT1 and its flags (TOV1 pending before
+ * 	  the capture is raised again, the flags raised by the capture are cleared) are restored when it ends
+ * 	- LOGIC_ANALYZER_stream sends the records later through UART_sendByte :
+ * 		[SYNC] [COUNT LOW] [COUNT HIGH] then every record as [STATE] [T0] [T1] [T2] [T3] (timestamp LSB first)
+ */
+
+/* --------------------------------- */
+/* number of records of the ring buffer (must be a power of 2, every record takes 5 bytes of SRAM) */
+
+#define LOGIC_ANALYZER_BUFFER_SIZE							64
+
+/* --------------------------------- */
+/* Timer1 clock source used by the capture >> @ref : timer1_clock_source_t */
+/* NOTE: DIV_1 >> one tick per CPU cycle (125 ns at 8 MHz), Timer1 overflows every 65536 cycles */
+
+#define LOGIC_ANALYZER_TIMER_CLOCK							TIMER1_CLOCK_SOURCE_DIV_1
+
+/* --------------------------------- */
+/* maximum capture duration in Timer1 overflows (limits the interrupt blackout, 16 >> 131 ms at 8 MHz with DIV_1) */
+
+#define LOGIC_ANALYZER_MAX_DURATION_OVERFLOWS				16
+
+/* --------------------------------- */
+/* first byte of a streamed capture */
+
+#define LOGIC_ANALYZER_STREAM_SYNC							0xA5
+
+/* --------------------------------- */
+/* @ref : Logic Analyzer Buffer Full Action */
+
+#define LOGIC_ANALYZER_OVERWRITE_OLDEST						0
+#define LOGIC_ANALYZER_STOP_WHEN_FULL						1
+
+/* --------------------------------- */
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -----user_defined data type declaration section------ */
+
+/* Logic Analyzer record */
+typedef struct{
+	/* Timer1 overflows counted since the capture started (high word of the timestamp) */
+	uint16 timestamp_high;
+	/* TCNT1 value when the change is sampled (low word of the timestamp) */
+	uint16 timestamp_low;
+	/* new state of the sampled pins (the pins out of the mask are read as zero) */
+	uint8 state;
+}logic_analyzer_record_t;
+
+/* Logic Analyzer config structure */
+typedef struct{
+	/* the capture ends after this number of Timer1 overflows (65536 timer ticks each , up to LOGIC_ANALYZER_MAX_DURATION_OVERFLOWS) */
+	uint16 duration_overflows;
+	/* holds the sampled pins of the port (bit = 1 >> the pin is sampled) */
+	uint8 pins_mask;
+	/* holds the port ID >> @ref : gpio port index */
+	uint8 port				:2;
+	/* action when the ring buffer is full >> @ref : Logic Analyzer Buffer Full Action */
+	uint8 buffer_full_action:1;
+
+	/* Reserved */
+	uint8					:5;
+}logic_analyzer_config_t;
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  capture the changes of the sampled pins :
+ * 			1- Save Timer1 control registers, TCNT1 and flags then run Timer1 in Normal Mode
+ * 			2- Record the initial state of the pins
+ * 			3- Sample the pins in a polled loop with the interrupts disabled and record every change with its timestamp
+ * 			4- End the capture after the required duration (or when the buffer is full if required)
+ * 			5- Restore Timer1 control registers, TCNT1 and flags and the interrupts
+ * @param  (la_obj)   pointer to the Logic Analyzer object passed by reference
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (or duration_overflows is higher than LOGIC_ANALYZER_MAX_DURATION_OVERFLOWS)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType LOGIC_ANALYZER_capture(const logic_analyzer_config_t *la_obj);
+
+
+/**
+ * @brief  get the number of records of the last capture
+ * @return number of records
+ */
+uint16 LOGIC_ANALYZER_getRecordsCount(void);
+
+
+/**
+ * @brief  get a record of the last capture (index 0 is the oldest record)
+ * @param  (index)    index of the record
+ * @param  (record)   pointer to the record to be filled
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType LOGIC_ANALYZER_getRecord(uint16 index , logic_analyzer_record_t *record);
+
+
+/**
+ * @brief  send the records of the last capture through UART (UART must be initialized)
+ */
+void LOGIC_ANALYZER_stream(void);
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _LOGIC_ANALYZER_H_ */
@@ -0,0 +1,607 @@
+/*
+ =========================================================================================
+ Name        : packet.c
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : PACKET Layer Service Source file , Ansi-style
+ =========================================================================================
+*/
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "packet.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/* CRC-16/CCITT */
+#define PACKET_CRC_POLYNOMIAL								0x1021
+#define PACKET_CRC_INITIAL_VALUE							0xFFFF
+
+/* COBS : a block code is the block length + 1, the longest block (254 bytes) isn't followed by a 0x00 */
+#define PACKET_COBS_NO_BLOCK								0x00
+#define PACKET_COBS_MAX_CODE								0xFF
+
+/* the decoder holds no buffer */
+#define PACKET_NO_BUFFER									0xFF
+
+/* --------------------------------- */
+/* @ref : Packet Decoder State */
+
+#define PACKET_DECODER_RECEIVING							0
+#define PACKET_DECODER_DISCARDING							1
+
+/* --------------------------------- */
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+/* position of a free running index in the free/received buffers queues */
+#define PACKET_POOL_INDEX(INDEX)							( (INDEX) & (PACKET_POOL_SIZE - 1) )
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -------------------Global section-------------------- */
+
+/* pool of packet buffers */
+static packet_buffer_t packet_pool[PACKET_POOL_SIZE];
+
+/* free buffers queue (single producer : PACKET_release >> head , single consumer : decoder >> tail) */
+static volatile uint8 packet_free_queue[PACKET_POOL_SIZE];
+static volatile uint8 packet_free_head = ZERO_INIT;
+static volatile uint8 packet_free_tail = ZERO_INIT;
+
+/* received packets queue (single producer : decoder >> head , single consumer : PACKET_receive >> tail) */
+static volatile uint8 packet_received_queue[PACKET_POOL_SIZE];
+static volatile uint8 packet_received_head = ZERO_INIT;
+static volatile uint8 packet_received_tail = ZERO_INIT;
+
+/* buffers owned by the application (TRUE >> returned by PACKET_receive and not released yet , used by the application side only) */
+static uint8 packet_app_owned[PACKET_POOL_SIZE];
+
+/* decoder (used by the USART RX Complete ISR only) */
+static uint8 packet_decoder_buffer = PACKET_NO_BUFFER;		/* buffer being filled */
+static uint8 packet_decoder_length = ZERO_INIT;				/* decoded bytes (payload + CRC) */
+static uint8 packet_decoder_code = PACKET_COBS_NO_BLOCK;	/* code of the current COBS block */
+static uint8 packet_decoder_left = ZERO_INIT;				/* bytes left in the current COBS block */
+static uint8 packet_decoder_state = PACKET_DECODER_RECEIVING;	/* >> @ref : Packet Decoder State */
+static uint16 packet_decoder_crc = PACKET_CRC_INITIAL_VALUE;	/* CRC of the decoded bytes */
+
+/* statistics */
+static volatile packet_statistics_t packet_statistics;
+
+/* create a pointer to function to hold the address of the call back function */
+static void (* PACKET_ReceivedHandler)(void) = NULL_PTR;
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  USART RX Complete call back : read the received byte and decode it
+ */
+static void PACKET_rxCompleteHandler(void);
+
+
+/**
+ * @brief  decode one received byte of a frame
+ * @param  (data) the received byte
+ */
+static void PACKET_decodeByte(uint8 data);
+
+
+/**
+ * @brief  add a decoded byte to the buffer of the decoder and to the CRC
+ * @param  (data) the decoded byte
+ */
+static void PACKET_storeByte(uint8 data);
+
+
+/**
+ * @brief  end the frame being decoded : queue its buffer if it's good then reset the decoder
+ */
+static void PACKET_endFrame(void);
+
+
+/**
+ * @brief  update a CRC-16/CCITT with one byte
+ * @param  (crc)  the CRC before the byte
+ * @param  (data) the byte
+ * @return the CRC after the byte
+ */
+static uint16 PACKET_updateCrc(uint16 crc , uint8 data);
+
+
+/**
+ * @brief  get a byte of the sent frame content ([PAYLOAD] [CRC HIGH] [CRC LOW])
+ * @param  (payload) pointer to the payload
+ * @param  (length)  number of bytes of the payload
+ * @param  (crc)     CRC of the payload
+ * @param  (index)   index of the byte in the frame content
+ * @return the byte
+ */
+static uint8 PACKET_getFrameByte(const uint8 *payload , uint8 length , uint16 crc , uint16 index);
+
+
+/**
+ * @brief  send a byte of a frame by the UART driver
+ * @param  (data) the byte
+ */
+static void PACKET_sendByte(uint8 data);
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions definition section------------- */
+
+
+/**
+ * @brief  initialize the Packet Layer :
+ * 			1- Free all the buffers of the pool and reset the decoder and the statistics
+ * 			2- Save the Packet Received Call Back
+ * 			3- Set the RX Complete Call Back of the UART object to the decoder then initialize the UART
+ * @param  (uart_obj)         pointer to the UART object passed by reference
+ * @param  (received_handler) called in the APPLICATION layer (ISR context) when a packet is received (NULL_PTR >> no call back)
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType PACKET_init(uart_config_t *uart_obj , void (* received_handler)(void))
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to traverse the pool */
+	uint8 l_index = ZERO_INIT;
+
+	if( (NULL_PTR == uart_obj) || (UART_CHARACTER_SIZE_8_BITS != uart_obj->char_size) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		/* --------------------------------- */
+		/* Free all the buffers of the pool and reset the decoder and the statistics (before the RX interrupt is enabled) */
+		for(l_index = 0; l_index < PACKET_POOL_SIZE; l_index++)
+		{
+			packet_free_queue[l_index] = l_index;
+			packet_app_owned[l_index] = FALSE;
+		}
+		packet_free_head = PACKET_POOL_SIZE;
+		packet_free_tail = ZERO_INIT;
+		packet_received_head = ZERO_INIT;
+		packet_received_tail = ZERO_INIT;
+
+		packet_decoder_buffer = PACKET_NO_BUFFER;
+		PACKET_endFrame();
+
+		packet_statistics.rx_errors = ZERO_INIT;
+		packet_statistics.rx_dropped = ZERO_INIT;
+		/* --------------------------------- */
+
+		/* Save the Packet Received Call Back */
+		PACKET_ReceivedHandler = received_handler;
+
+		/* Set the RX Complete Call Back of the UART object to the decoder then initialize the UART */
+		uart_obj->USART_RX_Complete_DefaultHandler = PACKET_rxCompleteHandler;
+		uart_obj->receiver_enable = USART_RECEIVER_ENABLE;
+		uart_obj->rx_complete_interrupt_en = USART_RX_COMPLETE_INTERRUPT_ENABLE;
+
+		l_status = UART_init(uart_obj);
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  send a packet : encode the payload and its CRC in a COBS frame and send it by the UART driver
+ * @param  (payload) pointer to the payload
+ * @param  (length)  number of bytes of the payload (1..PACKET_MAX_PAYLOAD_SIZE)
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType PACKET_send(const uint8 *payload , uint8 length)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the CRC of the payload */
+	uint16 l_crc = PACKET_CRC_INITIAL_VALUE;
+	/* create local variables to hold the frame content size, the first byte and the end of the current COBS block */
+	uint16 l_size = ZERO_INIT;
+	uint16 l_block = ZERO_INIT;
+	uint16 l_end = ZERO_INIT;
+	/* create a local variable to hold the code of the current COBS block */
+	uint8 l_code = ZERO_INIT;
+
+	if( (NULL_PTR == payload) || (ZERO_INIT == length) || (length > PACKET_MAX_PAYLOAD_SIZE) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		l_status = E_OK;		/* operation success */
+
+		/* --------------------------------- */
+		/* CRC of the payload */
+		for(l_end = 0; l_end < length; l_end++)
+		{
+			l_crc = PACKET_updateCrc(l_crc , payload[l_end]);
+		}
+		/* --------------------------------- */
+
+		/* --------------------------------- */
+		/* COBS encoding on the fly : every block is sent as [CODE] [the bytes before the next 0x00 (up to 254)] */
+		l_size = (uint16)length + PACKET_CRC_SIZE;
+
+		while(l_block <= l_size)
+		{
+			/* find the end of the block */
+			l_end = l_block;
+			while( (l_end < l_size) && ( (l_end - l_block) < (PACKET_COBS_MAX_CODE - 1) ) &&
+				   (PACKET_DELIMITER != PACKET_getFrameByte(payload , length , l_crc , l_end)) )
+			{
+				l_end++;
+			}
+			l_code = (uint8)(l_end - l_block + 1);
+
+			/* send the block */
+			PACKET_sendByte(l_code);
+			for( ; l_block < l_end; l_block++)
+			{
+				PACKET_sendByte( PACKET_getFrameByte(payload , length , l_crc , l_block) );
+			}
+
+			/* the 0x00 ending the block is removed, the longest block has no 0x00 after it */
+			if( (l_end == l_size) && (PACKET_COBS_MAX_CODE == l_code) )
+			{
+				break;
+			}
+			else if(PACKET_COBS_MAX_CODE != l_code)
+			{
+				l_block++;
+			}
+			else{ /* Nothing */ }
+		}
+
+		PACKET_sendByte(PACKET_DELIMITER);
+		/* --------------------------------- */
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  get the next received packet (O(1), the packets are received in order)
+ * @return pointer to the packet buffer (NULL_PTR if no packet is received), it must be given back by PACKET_release
+ */
+packet_buffer_t *PACKET_receive(void)
+{
+	/* create a local pointer to hold the received packet */
+	packet_buffer_t *l_packet = NULL_PTR;
+	/* create a local variable to hold the tail index */
+	uint8 l_tail = packet_received_tail;
+	/* create a local variable to hold the index of the received buffer */
+	uint8 l_index = ZERO_INIT;
+
+	if(l_tail != packet_received_head)
+	{
+		l_index = packet_received_queue[ PACKET_POOL_INDEX(l_tail) ];
+		packet_received_tail = (uint8)(l_tail + 1);
+
+		/* the buffer is owned by the application till it's released */
+		packet_app_owned[l_index] = TRUE;
+		l_packet = &packet_pool[l_index];
+	}
+	else{ /* Nothing */ }
+
+	return l_packet;
+}
+
+
+/**
+ * @brief  give a received packet buffer back to the pool (O(1))
+ * @param  (packet)   pointer to the packet buffer returned by PACKET_receive
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (the pointer isn't the start of a buffer of the pool,
+ *                          or the buffer isn't owned by the application : never received or already released)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType PACKET_release(packet_buffer_t *packet)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the head index */
+	uint8 l_head = packet_free_head;
+	/* create a local variable to hold the index of the released buffer */
+	uint8 l_index = ZERO_INIT;
+
+	/* the pointer must be exactly the start of a buffer of the pool */
+	if( (packet < &packet_pool[0]) || (packet > &packet_pool[PACKET_POOL_SIZE - 1]) ||
+		( ( ( (const uint8 *)packet - (const uint8 *)&packet_pool[0] ) % sizeof(packet_buffer_t) ) != 0 ) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		l_index = (uint8)(packet - &packet_pool[0]);
+
+		if(FALSE == packet_app_owned[l_index])
+		{
+			/* double release or the buffer isn't received (it may be used by the decoder) */
+			l_status = E_NOK;		/* operation failed */
+		}
+		else
+		{
+			l_status = E_OK;		/* operation success */
+
+			packet_app_owned[l_index] = FALSE;
+			packet_free_queue[ PACKET_POOL_INDEX(l_head) ] = l_index;
+			/* the buffer is given to the decoder by one store of the head */
+			packet_free_head = (uint8)(l_head + 1);
+		}
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  read the statistics of the received frames
+ * @param  (statistics) pointer to the statistics to be filled
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType PACKET_getStatistics(packet_statistics_t *statistics)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the Status Register */
+	uint8 l_sreg = ZERO_INIT;
+
+	if(NULL_PTR == statistics)
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		l_status = E_OK;		/* operation success */
+
+		/* the 16-bit counters are updated by the ISR */
+		CRITICAL_SECTION_ENTER(l_sreg);
+		statistics->rx_errors = packet_statistics.rx_errors;
+		statistics->rx_dropped = packet_statistics.rx_dropped;
+		CRITICAL_SECTION_EXIT(l_sreg);
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  USART RX Complete call back : read the received byte and decode it
+ */
+static void PACKET_rxCompleteHandler(void)
+{
+	/* RXC is set so the byte is read without waiting */
+	PACKET_decodeByte( (uint8)UART_recieveByte() );
+}
+
+
+/**
+ * @brief  decode one received byte of a frame
+ * @param  (data) the received byte
+ */
+static void PACKET_decodeByte(uint8 data)
+{
+	/* create a local variable to hold the tail index of the free buffers queue */
+	uint8 l_tail = ZERO_INIT;
+
+	if(PACKET_DELIMITER == data)
+	{
+		/* end of the frame */
+		PACKET_endFrame();
+	}
+	else if(PACKET_DECODER_DISCARDING == packet_decoder_state)
+	{
+		/* the frame is dropped, wait for its end */
+	}
+	else
+	{
+		/* --------------------------------- */
+		/* take a free buffer on the first byte of the frame */
+		if(PACKET_NO_BUFFER == packet_decoder_buffer)
+		{
+			l_tail = packet_free_tail;
+
+			if(l_tail != packet_free_head)
+			{
+				packet_decoder_buffer = packet_free_queue[ PACKET_POOL_INDEX(l_tail) ];
+				packet_free_tail = (uint8)(l_tail + 1);
+			}
+			else
+			{
+				/* no free buffer >> drop the frame */
+				packet_statistics.rx_dropped++;
+				packet_decoder_state = PACKET_DECODER_DISCARDING;
+			}
+		}
+		else{ /* Nothing */ }
+		/* --------------------------------- */
+
+		/* --------------------------------- */
+		/* COBS decoding */
+		if(PACKET_DECODER_DISCARDING == packet_decoder_state)
+		{
+			/* Nothing */
+		}
+		else if(ZERO_INIT == packet_decoder_left)
+		{
+			/* the byte is the code of a new block, the previous block (if not the longest) ends with a 0x00 */
+			if( (PACKET_COBS_NO_BLOCK != packet_decoder_code) && (PACKET_COBS_MAX_CODE != packet_decoder_code) )
+			{
+				PACKET_storeByte(PACKET_DELIMITER);
+			}
+			else{ /* Nothing */ }
+
+			packet_decoder_code = data;
+			packet_decoder_left = (uint8)(data - 1);
+		}
+		else
+		{
+			/* the byte is a byte of the block */
+			PACKET_storeByte(data);
+			packet_decoder_left--;
+		}
+		/* --------------------------------- */
+	}
+}
+
+
+/**
+ * @brief  add a decoded byte to the buffer of the decoder and to the CRC
+ * @param  (data) the decoded byte
+ */
+static void PACKET_storeByte(uint8 data)
+{
+	if(packet_decoder_length < (PACKET_MAX_PAYLOAD_SIZE + PACKET_CRC_SIZE))
+	{
+		packet_pool[packet_decoder_buffer].data[packet_decoder_length] = data;
+		packet_decoder_length++;
+		packet_decoder_crc = PACKET_updateCrc(packet_decoder_crc , data);
+	}
+	else
+	{
+		/* the payload is too long >> drop the frame */
+		packet_statistics.rx_errors++;
+		packet_decoder_state = PACKET_DECODER_DISCARDING;
+	}
+}
+
+
+/**
+ * @brief  end the frame being decoded : queue its buffer if it's good then reset the decoder
+ */
+static void PACKET_endFrame(void)
+{
+	/* create a local variable to hold the head index of the received packets queue */
+	uint8 l_head = packet_received_head;
+
+	/* a 0x00 without a frame before it (idle line) is ignored */
+	if( (PACKET_DECODER_RECEIVING == packet_decoder_state) && (PACKET_COBS_NO_BLOCK != packet_decoder_code) )
+	{
+		/* the CRC of the payload followed by its CRC (MSB first) is 0 */
+		if( (ZERO_INIT == packet_decoder_left) && (packet_decoder_length > PACKET_CRC_SIZE) && (ZERO_INIT == packet_decoder_crc) )
+		{
+			/* hand the buffer over in O(1) */
+			packet_pool[packet_decoder_buffer].length = (uint8)(packet_decoder_length - PACKET_CRC_SIZE);
+			packet_received_queue[ PACKET_POOL_INDEX(l_head) ] = packet_decoder_buffer;
+			packet_received_head = (uint8)(l_head + 1);
+			packet_decoder_buffer = PACKET_NO_BUFFER;
+
+			if(PACKET_ReceivedHandler)
+			{
+				/* Call Back */
+				(*PACKET_ReceivedHandler)();
+			}
+			else{ /* Nothing */ }
+		}
+		else
+		{
+			/* wrong frame >> its buffer is kept by the decoder for the next frame */
+			packet_statistics.rx_errors++;
+		}
+	}
+	else{ /* Nothing */ }
+
+	/* reset the decoder (a dropped frame is already counted) */
+	packet_decoder_length = ZERO_INIT;
+	packet_decoder_code = PACKET_COBS_NO_BLOCK;
+	packet_decoder_left = ZERO_INIT;
+	packet_decoder_state = PACKET_DECODER_RECEIVING;
+	packet_decoder_crc = PACKET_CRC_INITIAL_VALUE;
+}
+
+
+/**
+ * @brief  update a CRC-16/CCITT with one byte
+ * @param  (crc)  the CRC before the byte
+ * @param  (data) the byte
+ * @return the CRC after the byte
+ */
+static uint16 PACKET_updateCrc(uint16 crc , uint8 data)
+{
+	/* create a local variable to count the bits */
+	uint8 l_bit = ZERO_INIT;
+
+	crc ^= (uint16)( (uint16)data << 8 );
+
+	for(l_bit = 0; l_bit < 8; l_bit++)
+	{
+		if(crc & 0x8000)
+		{
+			crc = (uint16)( (crc << 1) ^ PACKET_CRC_POLYNOMIAL );
+		}
+		else
+		{
+			crc = (uint16)(crc << 1);
+		}
+	}
+
+	return crc;
+}
+
+
+/**
+ * @brief  get a byte of the sent frame content ([PAYLOAD] [CRC HIGH] [CRC LOW])
+ * @param  (payload) pointer to the payload
+ * @param  (length)  number of bytes of the payload
+ * @param  (crc)     CRC of the payload
+ * @param  (index)   index of the byte in the frame content
+ * @return the byte
+ */
+static uint8 PACKET_getFrameByte(const uint8 *payload , uint8 length , uint16 crc , uint16 index)
+{
+	/* create a local variable to hold the byte */
+	uint8 l_data = ZERO_INIT;
+
+	if(index < length)
+	{
+		l_data = payload[index];
+	}
+	else if(index == length)
+	{
+		l_data = (uint8)(crc >> 8);
+	}
+	else
+	{
+		l_data = (uint8)(crc);
+	}
+
+	return l_data;
+}
+
+
+/**
+ * @brief  send a byte of a frame by the UART driver
+ * @param  (data) the byte
+ */
+static void PACKET_sendByte(uint8 data)
+{
+#if USART_CFG_TX_RING_BUFFER
+	/* wait for a free place in the TX ring buffer */
+	while(ZERO_INIT == UART_write(&data , 1));
+#else
+	UART_sendByte(data);
+#endif
+}
+
+
+/* ----------------------------------------------------------------------------------- */
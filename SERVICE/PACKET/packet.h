@@ -0,0 +1,148 @@
+/*
+ =========================================================================================
+ Name        : packet.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : PACKET Layer Service Header file , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _PACKET_H_
+#define _PACKET_H_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "usart.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * Packet Layer Service (binary packets over the UART driver) :
+ * 	- frame : COBS( [PAYLOAD] [CRC HIGH] [CRC LOW] ) [0x00]
+ * 		- COBS (Consistent Overhead Byte Stuffing) removes every 0x00 from the frame so 0x00 only marks the frame end,
+ * 		  any binary payload is carried with at most 1 extra byte per 254 bytes
+ * 		- CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF) of the payload, sent MSB first
+ * 	- receive : the USART RX Complete ISR decodes the frame byte by byte straight into a buffer of a small pool
+ * 	  (the CRC is updated with every byte), a good frame is handed over in O(1) by queuing its buffer index :
+ * 		PACKET_receive >> get the next received packet , PACKET_release >> give its buffer back to the pool
+ * 	- a frame is dropped (and counted) if its CRC is wrong, it's longer than PACKET_MAX_PAYLOAD_SIZE or no buffer is free
+ * 	- send : PACKET_send encodes the payload and its CRC on the fly (no frame buffer) and sends it by the UART driver
+ * 	  (UART_write if the TX ring buffer is enabled, else UART_sendByte)
+ * 	- the UART must use 8 data bits, PACKET_init sets the RX Complete Call Back of the UART object then initializes it
+ */
+
+#if !USART_CFG_RX_COMPLETE_INTERRUPT
+#error "Packet Layer needs USART_CFG_RX_COMPLETE_INTERRUPT to be enabled"
+#endif
+
+/* --------------------------------- */
+/* maximum payload of a packet in bytes (1..253, every buffer of the pool takes PACKET_MAX_PAYLOAD_SIZE + 3 bytes of SRAM) */
+
+#define PACKET_MAX_PAYLOAD_SIZE								64
+
+/* --------------------------------- */
+/* number of packet buffers of the pool (power of two : 2..128) */
+/* NOTE: one buffer is used by the decoder while a frame is received, the others hold the received packets till they are released */
+
+#define PACKET_POOL_SIZE									4
+
+/* --------------------------------- */
+/* frame delimiter and CRC */
+
+#define PACKET_DELIMITER									0x00
+#define PACKET_CRC_SIZE										2
+
+/* --------------------------------- */
+
+#if ( PACKET_MAX_PAYLOAD_SIZE < 1 ) || ( PACKET_MAX_PAYLOAD_SIZE > 253 )
+#error "PACKET_MAX_PAYLOAD_SIZE must be from 1 to 253"
+#endif
+
+#if ( PACKET_POOL_SIZE < 2 ) || ( PACKET_POOL_SIZE > 128 ) || ( PACKET_POOL_SIZE & ( PACKET_POOL_SIZE - 1 ) )
+#error "PACKET_POOL_SIZE must be a power of two from 2 to 128"
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -----user_defined data type declaration section------ */
+
+/* Packet buffer */
+typedef struct{
+	/* the payload (followed by its CRC while the frame is decoded) */
+	uint8 data[PACKET_MAX_PAYLOAD_SIZE + PACKET_CRC_SIZE];
+	/* number of bytes of the payload */
+	uint8 length;
+}packet_buffer_t;
+
+/* Packet Layer statistics */
+typedef struct{
+	/* frames dropped for a wrong CRC, a wrong COBS encoding or a payload longer than PACKET_MAX_PAYLOAD_SIZE */
+	uint16 rx_errors;
+	/* frames dropped because no buffer of the pool was free */
+	uint16 rx_dropped;
+}packet_statistics_t;
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  initialize the Packet Layer :
+ * 			1- Free all the buffers of the pool and reset the decoder and the statistics
+ * 			2- Save the Packet Received Call Back
+ * 			3- Set the RX Complete Call Back of the UART object to the decoder then initialize the UART
+ * @param  (uart_obj)         pointer to the UART object passed by reference
+ * @param  (received_handler) called in the APPLICATION layer (ISR context) when a packet is received (NULL_PTR >> no call back)
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType PACKET_init(uart_config_t *uart_obj , void (* received_handler)(void));
+
+
+/**
+ * @brief  send a packet : encode the payload and its CRC in a COBS frame and send it by the UART driver
+ * @param  (payload) pointer to the payload
+ * @param  (length)  number of bytes of the payload (1..PACKET_MAX_PAYLOAD_SIZE)
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType PACKET_send(const uint8 *payload , uint8 length);
+
+
+/**
+ * @brief  get the next received packet (O(1), the packets are received in order)
+ * @return pointer to the packet buffer (NULL_PTR if no packet is received), it must be given back by PACKET_release
+ */
+packet_buffer_t *PACKET_receive(void);
+
+
+/**
+ * @brief  give a received packet buffer back to the pool (O(1))
+ * @param  (packet)   pointer to the packet buffer returned by PACKET_receive
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (the pointer isn't the start of a buffer of the pool,
+ *                          or the buffer isn't owned by the application : never received or already released)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType PACKET_release(packet_buffer_t *packet);
+
+
+/**
+ * @brief  read the statistics of the received frames
+ * @param  (statistics) pointer to the statistics to be filled
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType PACKET_getStatistics(packet_statistics_t *statistics);
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _PACKET_H_ */
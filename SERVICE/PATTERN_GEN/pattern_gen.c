@@ -0,0 +1,326 @@
+/*
+ =========================================================================================
+ Name        : pattern_gen.c
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : PATTERN GENERATOR Service Source file , Ansi-style
+ =========================================================================================
+*/
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "pattern_gen.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/* number of buffer slots (double buffering) */
+#define PATTERN_GEN_SLOTS									2
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -------------------Global section-------------------- */
+
+
+#if TIMER1_MODE_SELECT == TIMER1_MODE_CLEAR_TIMER_ON_COMPARE_MATCH
+/* configurations of the Pattern Generator */
+static pattern_gen_config_t pattern_gen_config;
+
+/* buffer slots */
+static pattern_gen_buffer_t pattern_gen_slots[PATTERN_GEN_SLOTS];
+
+/* used slots (bit (x) = 1 >> slot (x) holds a buffer) */
+static volatile uint8 pattern_gen_used_slots = ZERO_INIT;
+
+/* slot being played */
+static volatile uint8 pattern_gen_active_slot = ZERO_INIT;
+
+/* entry of the active slot to be written on the next Compare Match */
+static uint16 pattern_gen_entry = ZERO_INIT;
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+#if TIMER1_MODE_SELECT == TIMER1_MODE_CLEAR_TIMER_ON_COMPARE_MATCH
+/**
+ * @brief  TIMER1 Output Compare A Match call back : write one entry then move to the next entry/buffer
+ */
+static void PATTERN_GEN_compareMatchHandler(void);
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions definition section------------- */
+
+
+#if TIMER1_MODE_SELECT == TIMER1_MODE_CLEAR_TIMER_ON_COMPARE_MATCH
+/**
+ * @brief  initialize the Pattern Generator :
+ * 			1- Stop the Pattern Generator and free both buffer slots
+ * 			2- Set the driven pins of the port as output
+ * 			3- Save the configurations and the Buffer Done Call Back
+ * @param  (pg_obj)   pointer to the Pattern Generator object passed by reference
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType PATTERN_GEN_init(const pattern_gen_config_t *pg_obj)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+	/* create a local table to hold the driven pins to be set as output */
+	gpio_config_t l_pins[PIN_MAX];
+	/* create local variables to traverse the pins and count the driven pins */
+	uint8 l_pin_index = ZERO_INIT;
+	uint8 l_pins_num = ZERO_INIT;
+
+	if( (NULL_PTR == pg_obj) || (GPIO_PORT_MASK_ALL_CLEAR == pg_obj->pins_mask) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		/* Stop the Pattern Generator and free both buffer slots */
+		PATTERN_GEN_stop();
+
+		/* Set the driven pins of the port as output in one step (DDRx is written once) */
+		for(l_pin_index = GPIO_PIN0; l_pin_index < PIN_MAX; l_pin_index++)
+		{
+			if(pg_obj->pins_mask & (1 << l_pin_index))
+			{
+				l_pins[l_pins_num].port = pg_obj->port;
+				l_pins[l_pins_num].pin = l_pin_index;
+				l_pins[l_pins_num].mode = GPIO_MODE_OUTPUT;
+				l_pins_num++;
+			}
+			else{ /* Nothing */ }
+		}
+		l_status = GPIO_setupPinsFromTable( l_pins , l_pins_num );
+
+		/* Save the configurations and the Buffer Done Call Back */
+		if(E_OK == l_status)
+		{
+			pattern_gen_config = *pg_obj;
+		}
+		else{ /* Nothing */ }
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  queue a pattern buffer in the free slot (the buffer is copied, its entries are not)
+ * @param  (buffer)   pointer to the pattern buffer
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (no free slot or empty buffer)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType PATTERN_GEN_queue(const pattern_gen_buffer_t *buffer)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the Status Register */
+	uint8 l_sreg = ZERO_INIT;
+	/* create a local variable to hold the free slot */
+	uint8 l_slot = ZERO_INIT;
+
+	if( (NULL_PTR == buffer) || (NULL_PTR == buffer->data) || (ZERO_INIT == buffer->entries) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		/* disable the interrupts so the ISR can't switch the slots while the free slot is taken */
+		CRITICAL_SECTION_ENTER(l_sreg);
+
+		/* the active slot is taken first, then the other one */
+		if( !(pattern_gen_used_slots & (1 << pattern_gen_active_slot)) )
+		{
+			l_slot = pattern_gen_active_slot;
+			l_status = E_OK;		/* operation success */
+		}
+		else if( !(pattern_gen_used_slots & (1 << (pattern_gen_active_slot ^ 1))) )
+		{
+			l_slot = pattern_gen_active_slot ^ 1;
+			l_status = E_OK;		/* operation success */
+		}
+		else
+		{
+			l_status = E_NOK;		/* operation failed */
+		}
+
+		if(E_OK == l_status)
+		{
+			pattern_gen_slots[l_slot] = *buffer;
+			pattern_gen_used_slots |= (1 << l_slot);
+		}
+		else{ /* Nothing */ }
+
+		CRITICAL_SECTION_EXIT(l_sreg);
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  start playing the queued buffers on TIMER1 Output Compare A Match
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (no buffer is queued)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType PATTERN_GEN_start(void)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+
+	if( !(pattern_gen_used_slots & (1 << pattern_gen_active_slot)) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		l_status = E_OK;		/* operation success */
+
+		pattern_gen_entry = ZERO_INIT;
+		TIMER1_CTC_A_setCallBack(PATTERN_GEN_compareMatchHandler);
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  stop playing (the port keeps the last written entry) and free both buffer slots
+ */
+void PATTERN_GEN_stop(void)
+{
+	/* create a local variable to hold the Status Register */
+	uint8 l_sreg = ZERO_INIT;
+
+	CRITICAL_SECTION_ENTER(l_sreg);
+
+	TIMER1_CTC_A_setCallBack(NULL_PTR);
+	pattern_gen_used_slots = ZERO_INIT;
+	pattern_gen_active_slot = ZERO_INIT;
+	pattern_gen_entry = ZERO_INIT;
+
+	CRITICAL_SECTION_EXIT(l_sreg);
+}
+
+
+/**
+ * @brief  check if a buffer can be queued
+ * @return (TRUE)  a slot is free
+ *         (FALSE) both slots are used
+ */
+uint8 PATTERN_GEN_isSlotFree(void)
+{
+	return ( ((1 << PATTERN_GEN_SLOTS) - 1) != pattern_gen_used_slots );
+}
+
+
+/**
+ * @brief  TIMER1 Output Compare A Match call back : write one entry then move to the next entry/buffer
+ */
+static void PATTERN_GEN_compareMatchHandler(void)
+{
+	/* create a local pointer to hold the active buffer */
+	const pattern_gen_buffer_t *l_buffer = &pattern_gen_slots[pattern_gen_active_slot];
+	/* create local variables to hold the entry */
+	uint8 l_mask = pattern_gen_config.pins_mask;
+	uint8 l_image = ZERO_INIT;
+	/* create a local pointer to hold the address of the entry */
+	const uint8 *l_entry = l_buffer->data;
+
+	/* --------------------------------- */
+	/* Read the entry from RAM or flash */
+	if(PATTERN_GEN_FORMAT_MASKED_IMAGE == l_buffer->format)
+	{
+		l_entry += (pattern_gen_entry << 1);
+
+		if(PATTERN_GEN_MEMORY_FLASH == l_buffer->memory)
+		{
+			l_mask &= pgm_read_byte(l_entry);
+			l_image = pgm_read_byte(l_entry + 1);
+		}
+		else
+		{
+			l_mask &= l_entry[0];
+			l_image = l_entry[1];
+		}
+	}
+	else
+	{
+		l_entry += pattern_gen_entry;
+
+		if(PATTERN_GEN_MEMORY_FLASH == l_buffer->memory)
+		{
+			l_image = pgm_read_byte(l_entry);
+		}
+		else
+		{
+			l_image = l_entry[0];
+		}
+	}
+	/* --------------------------------- */
+
+	/* --------------------------------- */
+	/* Write the driven pins only (the 2-bit port ID is always valid and the interrupts are disabled in the ISR) */
+	GPIO_PORT_REG(pattern_gen_config.port) = (uint8)( ( GPIO_PORT_REG(pattern_gen_config.port) & (uint8)(~l_mask) ) | (l_image & l_mask) );
+	/* --------------------------------- */
+
+	/* --------------------------------- */
+	/* Move to the next entry, switch to the queued buffer after the last entry */
+	pattern_gen_entry++;
+
+	if(pattern_gen_entry >= l_buffer->entries)
+	{
+		pattern_gen_entry = ZERO_INIT;
+
+		if(pattern_gen_used_slots & (1 << (pattern_gen_active_slot ^ 1)))
+		{
+			/* free the finished slot and play the queued one */
+			pattern_gen_used_slots &= ~(1 << pattern_gen_active_slot);
+			pattern_gen_active_slot ^= 1;
+
+			if(pattern_gen_config.PATTERN_GEN_BufferDoneHandler)
+			{
+				/* Call Back */
+				(*pattern_gen_config.PATTERN_GEN_BufferDoneHandler)();
+			}
+			else{ /* Nothing */ }
+		}
+		else if(PATTERN_GEN_END_REPEAT == pattern_gen_config.end_action)
+		{
+			/* play the active buffer again */
+		}
+		else
+		{
+			/* no buffer is queued >> stop */
+			TIMER1_CTC_A_setCallBack(NULL_PTR);
+			pattern_gen_used_slots = ZERO_INIT;
+
+			if(pattern_gen_config.PATTERN_GEN_BufferDoneHandler)
+			{
+				/* Call Back */
+				(*pattern_gen_config.PATTERN_GEN_BufferDoneHandler)();
+			}
+			else{ /* Nothing */ }
+		}
+	}
+	else{ /* Nothing */ }
+	/* --------------------------------- */
+}
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
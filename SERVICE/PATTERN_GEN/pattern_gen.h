@@ -0,0 +1,151 @@
+/*
+ =========================================================================================
+ Name        : pattern_gen.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : PATTERN GENERATOR Service Header file , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _PATTERN_GEN_H_
+#define _PATTERN_GEN_H_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include <avr/pgmspace.h>			/* For patterns stored in flash */
+
+#include "gpio.h"
+#include "timer1.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * Pattern Generator Service :
+ * 	- writes one entry of a pattern buffer to the port on every TIMER1 Output Compare A Match
+ * 	  (the rate is the CTC rate the application configured with TIMER1_CTC_init)
+ * 	- only the pins of the configured mask are driven, the other pins of the port are kept
+ * 	- two buffer slots (double buffering) : while the active buffer plays the application queues the next one,
+ * 	  the switch happens inside the ISR right after the last entry so the stream has no gap
+ * 	- the Buffer Done call back (ISR context) tells the application a slot is free to be queued again
+ * 	- the service is compiled only when TIMER1_MODE_SELECT = TIMER1_MODE_CLEAR_TIMER_ON_COMPARE_MATCH
+ */
+
+/* --------------------------------- */
+/* @ref : Pattern Memory */
+
+#define PATTERN_GEN_MEMORY_RAM								0
+#define PATTERN_GEN_MEMORY_FLASH							1
+
+/* --------------------------------- */
+/* @ref : Pattern Entry Format */
+
+/* 1 byte per entry  : [IMAGE] (the pins mask of the config is used) */
+#define PATTERN_GEN_FORMAT_IMAGE							0
+/* 2 bytes per entry : [MASK] [IMAGE] (the entry mask is ANDed with the pins mask of the config) */
+#define PATTERN_GEN_FORMAT_MASKED_IMAGE						1
+
+/* --------------------------------- */
+/* @ref : Pattern End Action (the active buffer ends and no buffer is queued) */
+
+#define PATTERN_GEN_END_STOP								0
+#define PATTERN_GEN_END_REPEAT								1
+
+/* --------------------------------- */
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -----user_defined data type declaration section------ */
+#if TIMER1_MODE_SELECT == TIMER1_MODE_CLEAR_TIMER_ON_COMPARE_MATCH
+
+/* Pattern buffer */
+typedef struct{
+	/* pointer to the first entry of the pattern (RAM address or flash address) */
+	const uint8 *data;
+	/* number of entries of the pattern */
+	uint16 entries;
+	/* the memory holding the pattern >> @ref : Pattern Memory */
+	uint8 memory	:1;
+	/* the format of the entries >> @ref : Pattern Entry Format */
+	uint8 format	:1;
+
+	/* Reserved */
+	uint8			:6;
+}pattern_gen_buffer_t;
+
+/* Pattern Generator config structure */
+typedef struct{
+	/* pointer to function to hold the function called in the APPLICATION layer (ISR context) when a buffer is done and its slot is free */
+	void (* PATTERN_GEN_BufferDoneHandler)(void);
+
+	/* holds the driven pins of the port (bit = 1 >> the pin is driven) */
+	uint8 pins_mask;
+	/* holds the port ID >> @ref : gpio port index */
+	uint8 port			:2;
+	/* action when the active buffer ends and no buffer is queued >> @ref : Pattern End Action */
+	uint8 end_action	:1;
+
+	/* Reserved */
+	uint8				:5;
+}pattern_gen_config_t;
+
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+#if TIMER1_MODE_SELECT == TIMER1_MODE_CLEAR_TIMER_ON_COMPARE_MATCH
+/**
+ * @brief  initialize the Pattern Generator :
+ * 			1- Stop the Pattern Generator and free both buffer slots
+ * 			2- Set the driven pins of the port as output
+ * 			3- Save the configurations and the Buffer Done Call Back
+ * @param  (pg_obj)   pointer to the Pattern Generator object passed by reference
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed
+ *              (E_OK)      operation success
+ */
+Std_ReturnType PATTERN_GEN_init(const pattern_gen_config_t *pg_obj);
+
+
+/**
+ * @brief  queue a pattern buffer in the free slot (the buffer is copied, its entries are not)
+ * @param  (buffer)   pointer to the pattern buffer
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (no free slot or empty buffer)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType PATTERN_GEN_queue(const pattern_gen_buffer_t *buffer);
+
+
+/**
+ * @brief  start playing the queued buffers on TIMER1 Output Compare A Match
+ * @return (l_status) status of the performed operation
+ *              (E_NOT_OK)  operation failed (no buffer is queued)
+ *              (E_OK)      operation success
+ */
+Std_ReturnType PATTERN_GEN_start(void);
+
+
+/**
+ * @brief  stop playing (the port keeps the last written entry) and free both buffer slots
+ */
+void PATTERN_GEN_stop(void);
+
+
+/**
+ * @brief  check if a buffer can be queued
+ * @return (TRUE)  a slot is free
+ *         (FALSE) both slots are used
+ */
+uint8 PATTERN_GEN_isSlotFree(void);
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _PATTERN_GEN_H_ */
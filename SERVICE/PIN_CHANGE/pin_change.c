@@ -0,0 +1,178 @@
+/*
+ =========================================================================================
+ Name        : pin_change.c
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : PIN CHANGE Service Source file , Ansi-style
+ =========================================================================================
+*/
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "pin_change.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -------------------Global section-------------------- */
+
+/* last sampled logic of the pins of every port */
+static uint8 pin_change_snapshot[PORT_MAX];
+
+/* subscribed pins of every port (bit = 1 >> the pin has a call back) */
+static volatile uint8 pin_change_subscribed[PORT_MAX];
+
+/* call back of every pin */
+static pin_change_callback_t pin_change_callbacks[PORT_MAX][PIN_MAX];
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions definition section------------- */
+
+
+/**
+ * @brief  initialize the Pin Change Service :
+ * 				1- Take the snapshot of all the ports
+ * 				2- Unsubscribe all the pins
+ */
+void PIN_CHANGE_init(void)
+{
+	/* create a local variable to traverse the ports */
+	uint8 l_port = ZERO_INIT;
+	/* create a local variable to traverse the pins */
+	uint8 l_pin = ZERO_INIT;
+
+	for(l_port = 0; l_port < PORT_MAX; l_port++)
+	{
+		pin_change_snapshot[l_port] = GPIO_PIN_REG(l_port);
+		pin_change_subscribed[l_port] = ZERO_INIT;
+
+		for(l_pin = 0; l_pin < PIN_MAX; l_pin++)
+		{
+			pin_change_callbacks[l_port][l_pin] = NULL_PTR;
+		}
+	}
+}
+
+
+/**
+ * @brief  subscribe a call back to the changes of a pin
+ * @param  (port)       port index >> @ref : gpio port index
+ * @param  (pin)        pin index  >> @ref : gpio pin index
+ * @param  (callback)   function to be called with the new logic when the pin changes
+ * @return (l_status)	status of the function
+ * 		   (E_NOT_OK)  operation failed
+ * 		   (E_OK)      operation success
+ */
+Std_ReturnType PIN_CHANGE_subscribe(uint8 port , uint8 pin , pin_change_callback_t callback)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the Status Register */
+	uint8 l_sreg = ZERO_INIT;
+
+	if( (port >= PORT_MAX) || (pin >= PIN_MAX) || (NULL_PTR == callback) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		/* disable the interrupts so a tick from a Timer call back can't see a half subscribed pin */
+		CRITICAL_SECTION_ENTER(l_sreg);
+
+		pin_change_callbacks[port][pin] = callback;
+
+		/* refresh the snapshot of the pin so an old change isn't reported */
+		if(GPIO_PIN_REG(port) & (1 << pin))
+		{
+			pin_change_snapshot[port] |= (1 << pin);
+		}
+		else
+		{
+			pin_change_snapshot[port] &= ~(1 << pin);
+		}
+
+		pin_change_subscribed[port] |= (1 << pin);
+
+		CRITICAL_SECTION_EXIT(l_sreg);
+
+		l_status = E_OK;		/* operation success */
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  unsubscribe the call back of a pin
+ * @param  (port)       port index >> @ref : gpio port index
+ * @param  (pin)        pin index  >> @ref : gpio pin index
+ * @return (l_status)	status of the function
+ * 		   (E_NOT_OK)  operation failed
+ * 		   (E_OK)      operation success
+ */
+Std_ReturnType PIN_CHANGE_unsubscribe(uint8 port , uint8 pin)
+{
+	/* create a local variable to hold the status of the function */
+	Std_ReturnType l_status = ZERO_INIT;
+	/* create a local variable to hold the Status Register */
+	uint8 l_sreg = ZERO_INIT;
+
+	if( (port >= PORT_MAX) || (pin >= PIN_MAX) )
+	{
+		l_status = E_NOK;		/* operation failed */
+	}
+	else
+	{
+		/* disable the interrupts so a tick from a Timer call back can't call a removed call back */
+		CRITICAL_SECTION_ENTER(l_sreg);
+
+		pin_change_subscribed[port] &= ~(1 << pin);
+		pin_change_callbacks[port][pin] = NULL_PTR;
+
+		CRITICAL_SECTION_EXIT(l_sreg);
+
+		l_status = E_OK;		/* operation success */
+	}
+
+	return l_status;
+}
+
+
+/**
+ * @brief  sample all the ports and call the call backs of the subscribed pins which changed
+ */
+void PIN_CHANGE_tick(void)
+{
+	/* create a local variable to traverse the ports */
+	uint8 l_port = ZERO_INIT;
+	/* create a local variable to traverse the pins */
+	uint8 l_pin = ZERO_INIT;
+	/* create a local variable to hold the new sample of the port */
+	uint8 l_sample = ZERO_INIT;
+	/* create a local variable to hold the subscribed pins which changed */
+	uint8 l_changed = ZERO_INIT;
+
+	for(l_port = 0; l_port < PORT_MAX; l_port++)
+	{
+		/* sample the port once and diff it with the snapshot */
+		l_sample = GPIO_PIN_REG(l_port);
+		l_changed = (l_sample ^ pin_change_snapshot[l_port]) & pin_change_subscribed[l_port];
+		pin_change_snapshot[l_port] = l_sample;
+
+		/* dispatch the changed pins only, the loop ends after the last changed pin */
+		for(l_pin = 0; l_changed != 0; l_pin++ , l_changed >>= 1)
+		{
+			if( (l_changed & 1) && (NULL_PTR != pin_change_callbacks[l_port][l_pin]) )
+			{
+				pin_change_callbacks[l_port][l_pin]( (l_sample >> l_pin) & 1 );
+			}
+			else{ /* Nothing */ }
+		}
+	}
+}
+
+
+/* ----------------------------------------------------------------------------------- */
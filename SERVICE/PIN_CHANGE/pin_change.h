@@ -0,0 +1,81 @@
+/*
+ =========================================================================================
+ Name        : pin_change.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : PIN CHANGE Service Header file , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _PIN_CHANGE_H_
+#define _PIN_CHANGE_H_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "gpio.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * Pin Change Service :
+ * 	- keeps a snapshot of PINA..PIND, every PIN_CHANGE_tick XORs the new sample with the snapshot
+ * 	- the call back of a pin is called only if the pin is subscribed and its logic changed since the last tick
+ * 	- the call back gets the new logic of the pin >> @ref : gpio logic
+ * 	- PIN_CHANGE_tick is called periodically (from the main loop or a Timer call back)
+ */
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -----user_defined data type declaration section------ */
+
+/* pin change call back >> takes the new logic of the pin */
+typedef void (* pin_change_callback_t)(uint8 logic);
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  initialize the Pin Change Service :
+ * 				1- Take the snapshot of all the ports
+ * 				2- Unsubscribe all the pins
+ */
+void PIN_CHANGE_init(void);
+
+
+/**
+ * @brief  subscribe a call back to the changes of a pin
+ * @param  (port)       port index >> @ref : gpio port index
+ * @param  (pin)        pin index  >> @ref : gpio pin index
+ * @param  (callback)   function to be called with the new logic when the pin changes
+ * @return (l_status)	status of the function
+ * 		   (E_NOT_OK)  operation failed
+ * 		   (E_OK)      operation success
+ */
+Std_ReturnType PIN_CHANGE_subscribe(uint8 port , uint8 pin , pin_change_callback_t callback);
+
+
+/**
+ * @brief  unsubscribe the call back of a pin
+ * @param  (port)       port index >> @ref : gpio port index
+ * @param  (pin)        pin index  >> @ref : gpio pin index
+ * @return (l_status)	status of the function
+ * 		   (E_NOT_OK)  operation failed
+ * 		   (E_OK)      operation success
+ */
+Std_ReturnType PIN_CHANGE_unsubscribe(uint8 port , uint8 pin);
+
+
+/**
+ * @brief  sample all the ports and call the call backs of the subscribed pins which changed
+ */
+void PIN_CHANGE_tick(void);
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _PIN_CHANGE_H_ */
@@ -0,0 +1,1018 @@
+/*
+ =========================================================================================
+ Name        : bench.c
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : Driver APIs Cycle-Cost Micro-Benchmark Source file , Ansi-style
+ =========================================================================================
+*/
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include <stdio.h>
+
+#include "gpio.h"
+#include "usart.h"
+#include "spi.h"
+#include "adc.h"
+#include "lcd.h"
+#include "keypad.h"
+#include "timer1.h"					/* For Timer1 Clock Source Select (timer1.c isn't linked, Timer1 is the cycle counter) */
+
+#if ATMEGA32_HOST_BUILD
+#include "host_registers.h"
+#include "host_trace.h"
+#else
+#include <avr/interrupt.h>			/* For Timer1 Overflow ISR */
+#include <avr/sleep.h>				/* For stopping the simulator at the end of the benchmark */
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * Driver APIs Micro-Benchmark (driven by TOOLS/bench/bench.sh) :
+ * 	- every case calls one public driver API, one result line is printed per case then "BENCH END"
+ * 	- AVR build (hardware or simulator, the lines are sent by the UART) :
+ * 		BENCH UART_sendByte cycles=8391 wait=8330 cpu=61
+ * 			cycles : CPU cycles of the call (Timer1 at F_CPU, the cost of an empty call is subtracted), minimum of the iterations
+ * 			wait   : cycles spent in the blocking waits, the flag polled by the API is timed alone by the wait probe of the case
+ * 					 and the delays of util/delay.h are counted by TOOLS/bench/util/delay.h
+ * 			cpu    : cycles - wait (the work of the driver code)
+ * 	- host build (register file of COMMON/HOST, the lines are printed on stdout and the Register summaries on stderr) :
+ * 		BENCH UART_sendByte accesses=3 reads=2 writes=1 waits=1 delay_us=0 est_cycles=8345 est_wait=8333 est_cpu=12
+ * 			accesses        : Register accesses of the call >> @ref : host_trace.h
+ * 			reads/writes    : Register loads and stores of the call (an access which changes the Register is a write,
+ * 							  a store of the same value is counted as a read >> @ref : host_registers.h)
+ * 			waits           : blocking waits on a peripheral flag (the peripheral models become ready on the first busy poll)
+ * 			delay_us        : time of the util/delay.h delays
+ * 			est_cycles      : estimated CPU cycles of the call = est_wait + est_cpu (no AVR toolchain is needed)
+ * 			est_wait        : estimated blocking-wait cycles : the busy time of the peripheral of every wait (BENCH_HOST_xxx_WAIT_CYCLES
+ * 							  in the configurations of BENCH_init) and the delays at CPU_FREQUENCY
+ * 			est_cpu         : estimated CPU work : the Register loads/stores out of the busy polls and the call (BENCH_HOST_xxx_CYCLES),
+ * 							  the other instructions of the driver code aren't seen by the host so it's a lower bound of the AVR cpu
+ * 			the est_xxx fields aren't measured : two APIs with the same Register accesses have the same estimate,
+ * 			only the AVR build measures the cycles of the driver code
+ * 	- no AVR baseline is committed (it needs avr-gcc and simavr or a board) : the first --avr run is done with --update
+ */
+
+/* --------------------------------- */
+/* Benchmark Configurations */
+
+/* number of runs of every case (the run with the minimum cycles is reported) */
+#define BENCH_CFG_ITERATIONS					8
+
+/* UART used to send the results in the AVR build */
+#define BENCH_CFG_BAUD_RATE						9600
+
+/* size of a result line */
+#define BENCH_LINE_SIZE							160
+
+/* --------------------------------- */
+/* Host build cycle estimate (AVR instruction timing, the AVR build measures the cycles) */
+
+/* CPU cycles of a Register load and store (LDS/STS and LD/ST take 2 cycles, IN/OUT take 1) */
+#define BENCH_HOST_LOAD_CYCLES					2
+#define BENCH_HOST_STORE_CYCLES					2
+
+/* CPU cycles of the call and the return of the API (CALL + RET) */
+#define BENCH_HOST_CALL_CYCLES					8
+
+/* busy time of the peripheral models in CPU cycles (configurations of BENCH_init) */
+#define BENCH_HOST_UART_WAIT_CYCLES				( (CPU_FREQUENCY * 10UL) / BENCH_CFG_BAUD_RATE )	/* a frame : start + 8 data + stop bits */
+#define BENCH_HOST_SPI_WAIT_CYCLES				(8UL * 4UL)											/* 8 bits at F_CPU / 4 */
+#define BENCH_HOST_ADC_WAIT_CYCLES				(13UL * 64UL)										/* a conversion : 13 ADC clocks at F_CPU / 64 */
+
+/* --------------------------------- */
+/* End of line of the results */
+
+#if ATMEGA32_HOST_BUILD
+#define BENCH_END_OF_LINE						"\n"
+#else
+#define BENCH_END_OF_LINE						"\r\n"
+#endif
+
+/* --------------------------------- */
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+/* pins of the LCD data bus and the keypad rows/columns in the pin groups or the pin tables */
+#if LCD_CONFIG_DATA_BUS_GROUP
+#define BENCH_LCD_DATA_BUS(INDEX)				(bench_lcd.data_bus.pins[INDEX])
+#else
+#define BENCH_LCD_DATA_BUS(INDEX)				(bench_lcd.data_bus[INDEX])
+#endif
+
+#define BENCH_KEYPAD_ROW(INDEX)					(bench_keypad.rows[INDEX])
+#if KEYPAD_CONFIG_PIN_GROUPS
+#define BENCH_KEYPAD_COLUMN(INDEX)				(bench_keypad.columns.pins[INDEX])
+#else
+#define BENCH_KEYPAD_COLUMN(INDEX)				(bench_keypad.columns[INDEX])
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -----user_defined data type declaration section------ */
+
+/* benchmark case structure */
+typedef struct{
+	/* name of the case (the benchmarked API) */
+	const char *name;
+	/* puts the peripheral in the state before the call (NULL_PTR >> no setup) */
+	void (* setup)(void);
+	/* calls the benchmarked API */
+	void (* run)(void);
+	/* polls the flag polled by the API alone to time the blocking wait, called after the setup (NULL_PTR >> no wait) */
+	void (* wait_probe)(void);
+}bench_case_t;
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  initialize the drivers under benchmark and the measurement (Timer1 or the peripheral models)
+ */
+static void BENCH_init(void);
+
+
+/**
+ * @brief  run a benchmark case and print its result line
+ * @param  (bench_case) pointer to the case
+ */
+static void BENCH_runCase(const bench_case_t *bench_case);
+
+
+/**
+ * @brief  print a line of the results
+ * @param  (line) the line to be printed
+ */
+static void BENCH_print(const char *line);
+
+
+/**
+ * @brief  end the benchmark (the simulator stops on sleep with the interrupts disabled)
+ */
+static void BENCH_exit(void);
+
+
+#if ATMEGA32_HOST_BUILD
+/**
+ * @brief  peripheral model of the PINx Registers : the pins read the value written on the PORTx Register
+ * @param  (address) data memory address of the PINx Register
+ */
+static void BENCH_modelPin(uint8 address);
+
+
+/**
+ * @brief  peripheral model of UCSRA : the transmit buffer becomes empty on the first busy poll
+ * @param  (address) data memory address of UCSRA
+ */
+static void BENCH_modelUcsra(uint8 address);
+
+
+/**
+ * @brief  peripheral model of UDR : the transmit buffer becomes full when a character is written
+ * @param  (address) data memory address of UDR
+ */
+static void BENCH_modelUdr(uint8 address);
+
+
+/**
+ * @brief  peripheral model of SPSR : the serial transfer completes on the first busy poll
+ * @param  (address) data memory address of SPSR
+ */
+static void BENCH_modelSpsr(uint8 address);
+
+
+/**
+ * @brief  peripheral model of SPDR : SPIF is cleared by the SPDR access after SPSR is read
+ * @param  (address) data memory address of SPDR
+ */
+static void BENCH_modelSpdr(uint8 address);
+
+
+/**
+ * @brief  peripheral model of ADCSRA : the conversion completes on the first busy poll
+ * @param  (address) data memory address of ADCSRA
+ */
+static void BENCH_modelAdcsra(uint8 address);
+#else
+/**
+ * @brief  read the 32-bit cycle counter (Timer1 and its overflows)
+ * @return the number of cycles since Timer1 is started
+ */
+static uint32 BENCH_getCycles(void);
+
+
+/**
+ * @brief  measure the cycles of a function call
+ * @param  (function) the function to be measured
+ * @return the cycles of the call minus the cost of an empty call
+ */
+static uint32 BENCH_measure(void (* function)(void));
+#endif
+
+
+/* --------------------------------- */
+/* benchmark cases */
+
+#if !ATMEGA32_HOST_BUILD
+static void BENCH_runEmpty(void);
+#endif
+static void BENCH_runGpioWritePin(void);
+static void BENCH_runGpioReadPin(void);
+static void BENCH_runGpioWritePinFast(void);
+static void BENCH_runGpioReadPinFast(void);
+static void BENCH_runGpioWritePort(void);
+static void BENCH_runGpioWritePortMasked(void);
+static void BENCH_runGpioReadAllPorts(void);
+static void BENCH_runGpioSetupPinDirection(void);
+static void BENCH_runGpioTogglePinFast(void);
+static void BENCH_runGpioReadPort(void);
+static void BENCH_runGpioSetPortBits(void);
+static void BENCH_runGpioClearPortBits(void);
+static void BENCH_runGpioBusWrite(void);
+static void BENCH_runGpioBusRead(void);
+static void BENCH_setupUart(void);
+static void BENCH_runUartSendByte(void);
+static void BENCH_probeUart(void);
+static void BENCH_runUartSendString(void);
+static void BENCH_probeUartString(void);
+static void BENCH_setupSpi(void);
+static void BENCH_runSpiSendReceiveByte(void);
+static void BENCH_probeSpi(void);
+static void BENCH_runSpiSendByte(void);
+static void BENCH_runSpiReceiveByte(void);
+static void BENCH_runSpiSendString(void);
+static void BENCH_probeSpiString(void);
+static void BENCH_runAdcReadChannelBlocking(void);
+static void BENCH_probeAdc(void);
+static void BENCH_runAdcReadChannelNonBlocking(void);
+static void BENCH_runLcdSendCommand(void);
+static void BENCH_runLcdDisplayCharacter(void);
+static void BENCH_runLcdDisplayString(void);
+static void BENCH_runLcdMoveCursor(void);
+static void BENCH_runLcdIntegerToString(void);
+static void BENCH_runLcdClearScreen(void);
+static void BENCH_runKeypadGetPressedKey(void);
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -------------------Global section-------------------- */
+
+/* benchmark cases table */
+static const bench_case_t bench_cases[] = {
+	{ "GPIO_writePin"              , NULL_PTR        , BENCH_runGpioWritePin              , NULL_PTR              },
+	{ "GPIO_readPin"               , NULL_PTR        , BENCH_runGpioReadPin               , NULL_PTR              },
+	{ "GPIO_writePinFast"          , NULL_PTR        , BENCH_runGpioWritePinFast          , NULL_PTR              },
+	{ "GPIO_readPinFast"           , NULL_PTR        , BENCH_runGpioReadPinFast           , NULL_PTR              },
+	{ "GPIO_writePort"             , NULL_PTR        , BENCH_runGpioWritePort             , NULL_PTR              },
+	{ "GPIO_writePortMasked"       , NULL_PTR        , BENCH_runGpioWritePortMasked       , NULL_PTR              },
+	{ "GPIO_readAllPorts"          , NULL_PTR        , BENCH_runGpioReadAllPorts          , NULL_PTR              },
+	{ "GPIO_setupPinDirection"     , NULL_PTR        , BENCH_runGpioSetupPinDirection     , NULL_PTR              },
+	{ "GPIO_togglePinFast"         , NULL_PTR        , BENCH_runGpioTogglePinFast         , NULL_PTR              },
+	{ "GPIO_readPort"              , NULL_PTR        , BENCH_runGpioReadPort              , NULL_PTR              },
+	{ "GPIO_setPortBits"           , NULL_PTR        , BENCH_runGpioSetPortBits           , NULL_PTR              },
+	{ "GPIO_clearPortBits"         , NULL_PTR        , BENCH_runGpioClearPortBits         , NULL_PTR              },
+	{ "GPIO_busWrite"              , NULL_PTR        , BENCH_runGpioBusWrite              , NULL_PTR              },
+	{ "GPIO_busRead"               , NULL_PTR        , BENCH_runGpioBusRead               , NULL_PTR              },
+	{ "UART_sendByte"              , BENCH_setupUart , BENCH_runUartSendByte              , BENCH_probeUart       },
+	{ "UART_sendString"            , BENCH_setupUart , BENCH_runUartSendString            , BENCH_probeUartString },
+	{ "SPI_sendReceiveByte"        , BENCH_setupSpi  , BENCH_runSpiSendReceiveByte        , BENCH_probeSpi        },
+	{ "SPI_sendByte"               , BENCH_setupSpi  , BENCH_runSpiSendByte               , BENCH_probeSpi        },
+	{ "SPI_receiveByte"            , BENCH_setupSpi  , BENCH_runSpiReceiveByte            , BENCH_probeSpi        },
+	{ "SPI_sendString"             , BENCH_setupSpi  , BENCH_runSpiSendString             , BENCH_probeSpiString  },
+	{ "ADC_readChannelBlocking"    , NULL_PTR        , BENCH_runAdcReadChannelBlocking    , BENCH_probeAdc        },
+	{ "ADC_readChannelNonBlocking" , NULL_PTR        , BENCH_runAdcReadChannelNonBlocking , NULL_PTR              },
+	{ "LCD_sendCommand"            , NULL_PTR        , BENCH_runLcdSendCommand            , NULL_PTR              },
+	{ "LCD_displayCharacter"       , NULL_PTR        , BENCH_runLcdDisplayCharacter       , NULL_PTR              },
+	{ "LCD_displayString"          , NULL_PTR        , BENCH_runLcdDisplayString          , NULL_PTR              },
+	{ "LCD_moveCursor"             , NULL_PTR        , BENCH_runLcdMoveCursor             , NULL_PTR              },
+	{ "LCD_intgerToString"         , NULL_PTR        , BENCH_runLcdIntegerToString        , NULL_PTR              },
+	{ "LCD_clearScreen"            , NULL_PTR        , BENCH_runLcdClearScreen            , NULL_PTR              },
+	{ "KEYPAD_getPressedKey"       , NULL_PTR        , BENCH_runKeypadGetPressedKey       , NULL_PTR              }
+};
+
+/* characters sent by the string cases */
+static const uint8 bench_string[] = "OK\r\n";
+
+/* objects of the drivers under benchmark */
+static gpio_config_t bench_gpio_pin = { GPIO_PORTA , GPIO_PIN0 , GPIO_MODE_OUTPUT };
+static gpio_pin_handle_t bench_gpio_pin_handle;
+static gpio_bus_t bench_gpio_bus;
+static lcd_config_t bench_lcd;
+static keypad_config_t bench_keypad;
+
+/* holds the values returned by the benchmarked APIs so the calls are not removed */
+static volatile uint32 bench_sink = ZERO_INIT;
+
+#if ATMEGA32_HOST_BUILD
+/* blocking waits found by the peripheral models and their busy time in CPU cycles */
+static uint32 bench_waits = ZERO_INIT;
+static uint32 bench_wait_cycles = ZERO_INIT;
+#else
+/* cycles of the delays of util/delay.h >> @ref : TOOLS/bench/util/delay.h */
+volatile uint32 bench_delay_cycles = ZERO_INIT;
+
+/* high 16 bits of the cycle counter */
+static volatile uint16 bench_timer_overflows = ZERO_INIT;
+
+/* cycles of an empty call */
+static uint32 bench_overhead = ZERO_INIT;
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions definition section------------- */
+
+
+int main(void)
+{
+	/* create a local variable to traverse the cases table */
+	uint8 l_case = ZERO_INIT;
+
+	BENCH_init();
+
+	for(l_case = 0; l_case < (sizeof(bench_cases) / sizeof(bench_cases[0])); l_case++)
+	{
+		BENCH_runCase(&bench_cases[l_case]);
+	}
+
+	BENCH_print("BENCH END" BENCH_END_OF_LINE);
+
+	BENCH_exit();
+
+	return 0;
+}
+
+
+/**
+ * @brief  initialize the drivers under benchmark and the measurement (Timer1 or the peripheral models)
+ */
+static void BENCH_init(void)
+{
+	/* create local variables to hold the configurations of the drivers under benchmark */
+	uart_config_t l_uart = { .Baud_Rate = BENCH_CFG_BAUD_RATE , .receiver_enable = SET , .transmitter_enable = SET ,
+							 .char_size = UART_CHARACTER_SIZE_8_BITS , .parity_mode = UART_PARITY_MODE_DISABLE ,
+							 .stop_mode = UART_STOP_MODE_1_BIT };
+	spi_config_t l_spi = { .mode_select = SPI_MODE_MASTER_SELECT , .clk_rate = SPI_CLOCK_SOURCE_DIV_4 };
+	adc_config_t l_adc = { .voltage_reference_selection = ADC_AVCC_VOLTAGE_SELECT , .channel = ADC_CHANNEL0 ,
+						   .prescaler = ADC_FCPU_DIV_64 };
+	/* create a local variable to traverse the pins */
+	uint8 l_index = ZERO_INIT;
+#if !ATMEGA32_HOST_BUILD
+	/* create local variables to hold the cycles of an empty call and their minimum */
+	uint32 l_cycles = ZERO_INIT;
+	uint32 l_overhead = 0xFFFFFFFF;
+#endif
+
+#if ATMEGA32_HOST_BUILD
+	/* --------------------------------- */
+	/* peripheral models */
+	HOST_REG_reset();
+
+	HOST_REG_setAccessHook(PINA_ADDRESS , BENCH_modelPin);
+	HOST_REG_setAccessHook(PINB_ADDRESS , BENCH_modelPin);
+	HOST_REG_setAccessHook(PINC_ADDRESS , BENCH_modelPin);
+	HOST_REG_setAccessHook(PIND_ADDRESS , BENCH_modelPin);
+	HOST_REG_setAccessHook(UCSRA_ADDRESS , BENCH_modelUcsra);
+	HOST_REG_setWriteHook(UDR_ADDRESS , BENCH_modelUdr);
+	HOST_REG_setAccessHook(SPSR_ADDRESS , BENCH_modelSpsr);
+	HOST_REG_setAccessHook(SPDR_ADDRESS , BENCH_modelSpdr);
+	HOST_REG_setAccessHook(ADCSRA_ADDRESS , BENCH_modelAdcsra);
+
+	/* the Register summaries of the cases are printed away from the result lines */
+	HOST_TRACE_setOutput(stderr);
+	/* --------------------------------- */
+#endif
+
+	/* --------------------------------- */
+	/* drivers under benchmark */
+
+	/* the UART is initialized first, it sends the results in the AVR build */
+	UART_init(&l_uart);
+	SPI_init(&l_spi);
+	ADC_init(&l_adc);
+
+	GPIO_setupPinDirection(&bench_gpio_pin);
+	GPIO_pinHandleInit(&bench_gpio_pin , &bench_gpio_pin_handle);
+
+	/* gpio bus : bits 0..2 >> PA1..PA3 , bits 3..7 >> PB2..PB6 (two ports, one of them shifted) */
+	bench_gpio_bus.size = GPIO_BUS_MAX_SIZE;
+	for(l_index = 0; l_index < GPIO_BUS_MAX_SIZE; l_index++)
+	{
+		bench_gpio_bus.pins[l_index].port = (l_index < 3) ? GPIO_PORTA : GPIO_PORTB;
+		bench_gpio_bus.pins[l_index].pin = (l_index < 3) ? (GPIO_PIN1 + l_index) : (GPIO_PIN2 + l_index - 3);
+		bench_gpio_bus.pins[l_index].mode = GPIO_MODE_OUTPUT;
+	}
+	GPIO_busInit(&bench_gpio_bus);
+
+	/* LCD : RS >> PB0 , E >> PB1 , data bus (8-bit mode) >> PC0..PC7 (4-bit mode >> PC0..PC3) */
+	bench_lcd.register_select.port = GPIO_PORTB;
+	bench_lcd.register_select.pin = GPIO_PIN0;
+	bench_lcd.register_select.mode = GPIO_MODE_OUTPUT;
+	bench_lcd.enable.port = GPIO_PORTB;
+	bench_lcd.enable.pin = GPIO_PIN1;
+	bench_lcd.enable.mode = GPIO_MODE_OUTPUT;
+	for(l_index = 0; l_index < LCD_DATA_BUS_SIZE; l_index++)
+	{
+		BENCH_LCD_DATA_BUS(l_index).port = GPIO_PORTC;
+		BENCH_LCD_DATA_BUS(l_index).pin = l_index;
+		BENCH_LCD_DATA_BUS(l_index).mode = GPIO_MODE_OUTPUT;
+	}
+	LCD_init(&bench_lcd);
+
+	/* keypad : rows >> PD4..PD7 , columns >> PA4..PA7 */
+	for(l_index = 0; l_index < KEYPAD_ROW_MAX_SIZE; l_index++)
+	{
+		BENCH_KEYPAD_ROW(l_index).port = GPIO_PORTD;
+		BENCH_KEYPAD_ROW(l_index).pin = GPIO_PIN4 + l_index;
+		BENCH_KEYPAD_ROW(l_index).mode = GPIO_MODE_INPUT_WITHOUT_INTERNAL_PULL_UP_RES;
+	}
+	for(l_index = 0; l_index < KEYPAD_COLUMN_MAX_SIZE; l_index++)
+	{
+		BENCH_KEYPAD_COLUMN(l_index).port = GPIO_PORTA;
+		BENCH_KEYPAD_COLUMN(l_index).pin = GPIO_PIN4 + l_index;
+		BENCH_KEYPAD_COLUMN(l_index).mode = GPIO_MODE_INPUT_WITH_INTERNAL_PULL_UP_RES;
+	}
+#if KEYPAD_CONFIG_PIN_GROUPS
+	KEYPAD_init(&bench_keypad);
+#endif
+	/* --------------------------------- */
+
+#if !ATMEGA32_HOST_BUILD
+	/* --------------------------------- */
+	/* cycle counter : Timer1 Normal Mode, clock = F_CPU, Overflow Interrupt extends the counter to 32 bits */
+	_TCCR1A.Byte = ZERO_INIT;
+	_TCNT1.TwoBytes = ZERO_INIT;
+	_TIMSK._TOIE1 = SET;
+	_TCCR1B.Byte = ZERO_INIT;
+	_TCCR1B._CS1x = TIMER1_CLOCK_SOURCE_DIV_1;
+
+	GLOBAL_INTERRUPT_ENABLE();
+
+	/* cost of an empty call (the minimum of the iterations), measured before any overhead is subtracted */
+	bench_overhead = ZERO_INIT;
+	for(l_index = 0; l_index < BENCH_CFG_ITERATIONS; l_index++)
+	{
+		l_cycles = BENCH_measure(BENCH_runEmpty);
+		if(l_cycles < l_overhead)
+		{
+			l_overhead = l_cycles;
+		}
+		else{ /* Nothing */ }
+	}
+	bench_overhead = l_overhead;
+	/* --------------------------------- */
+#endif
+}
+
+
+#if ATMEGA32_HOST_BUILD
+/**
+ * @brief  run a benchmark case and print its result line
+ * @param  (bench_case) pointer to the case
+ */
+static void BENCH_runCase(const bench_case_t *bench_case)
+{
+	/* create a local variable to hold the delays time before the call */
+	float64 l_elapsed_us = 0.0;
+	/* create local variables to hold the estimated cycles : blocking waits and CPU work */
+	uint32 l_wait = ZERO_INIT;
+	uint32 l_cpu = ZERO_INIT;
+	/* create a local variable to hold the result line */
+	char l_line[BENCH_LINE_SIZE];
+
+	/* the calls are counted by the register file, one run is enough */
+	if(bench_case->setup)
+	{
+		(*bench_case->setup)();
+	}
+	else{ /* Nothing */ }
+
+	HOST_REG_sync();
+	bench_waits = ZERO_INIT;
+	bench_wait_cycles = ZERO_INIT;
+	l_elapsed_us = HOST_REG_getElapsedUs();
+
+	HOST_TRACE_begin(bench_case->name);
+	(*bench_case->run)();
+	HOST_TRACE_end();
+
+	l_elapsed_us = HOST_REG_getElapsedUs() - l_elapsed_us;
+
+	/* --------------------------------- */
+	/* estimated cycles : the busy polls (one per wait) belong to the wait, the other loads/stores and the call to the CPU work */
+	l_wait = bench_wait_cycles + (uint32)( (l_elapsed_us * (CPU_FREQUENCY / 1000000.0)) + 0.5 );
+	l_cpu = ( (HOST_TRACE_getReads() - bench_waits) * BENCH_HOST_LOAD_CYCLES ) +
+			( HOST_TRACE_getWrites() * BENCH_HOST_STORE_CYCLES ) + BENCH_HOST_CALL_CYCLES;
+	/* --------------------------------- */
+
+	snprintf(l_line , sizeof(l_line) ,
+			 "BENCH %s accesses=%lu reads=%lu writes=%lu waits=%lu delay_us=%lu est_cycles=%lu est_wait=%lu est_cpu=%lu" BENCH_END_OF_LINE ,
+			 bench_case->name , (unsigned long)HOST_TRACE_getAccesses() , (unsigned long)HOST_TRACE_getReads() ,
+			 (unsigned long)HOST_TRACE_getWrites() ,
+			 (unsigned long)bench_waits , (unsigned long)(l_elapsed_us + 0.5) ,
+			 (unsigned long)(l_wait + l_cpu) , (unsigned long)l_wait , (unsigned long)l_cpu);
+	BENCH_print(l_line);
+}
+#else
+/**
+ * @brief  run a benchmark case and print its result line
+ * @param  (bench_case) pointer to the case
+ */
+static void BENCH_runCase(const bench_case_t *bench_case)
+{
+	/* create local variables to hold the cycles of the run with the minimum cycles */
+	uint32 l_cycles = 0xFFFFFFFF;
+	uint32 l_wait = ZERO_INIT;
+	/* create local variables to hold the cycles of the current run */
+	uint32 l_run_cycles = ZERO_INIT;
+	uint32 l_run_wait = ZERO_INIT;
+	/* create a local variable to count the runs */
+	uint8 l_iteration = ZERO_INIT;
+	/* create a local variable to hold the result line */
+	char l_line[BENCH_LINE_SIZE];
+
+	for(l_iteration = 0; l_iteration < BENCH_CFG_ITERATIONS; l_iteration++)
+	{
+		if(bench_case->setup)
+		{
+			(*bench_case->setup)();
+		}
+		else{ /* Nothing */ }
+
+		bench_delay_cycles = ZERO_INIT;
+		l_run_cycles = BENCH_measure(bench_case->run);
+		l_run_wait = bench_delay_cycles;
+
+		/* the flag polled by the API is timed alone from the same state */
+		if(bench_case->wait_probe)
+		{
+			if(bench_case->setup)
+			{
+				(*bench_case->setup)();
+			}
+			else{ /* Nothing */ }
+
+			l_run_wait += BENCH_measure(bench_case->wait_probe);
+		}
+		else{ /* Nothing */ }
+
+		if(l_run_cycles < l_cycles)
+		{
+			l_cycles = l_run_cycles;
+			l_wait = (l_run_wait < l_run_cycles) ? l_run_wait : l_run_cycles;
+		}
+		else{ /* Nothing */ }
+	}
+
+	snprintf(l_line , sizeof(l_line) , "BENCH %s cycles=%lu wait=%lu cpu=%lu" BENCH_END_OF_LINE , bench_case->name ,
+			 (unsigned long)l_cycles , (unsigned long)l_wait , (unsigned long)(l_cycles - l_wait));
+	BENCH_print(l_line);
+}
+#endif
+
+
+/**
+ * @brief  print a line of the results
+ * @param  (line) the line to be printed
+ */
+static void BENCH_print(const char *line)
+{
+#if ATMEGA32_HOST_BUILD
+	fputs(line , stdout);
+#else
+	UART_sendString( (const uint8 *)line );
+#endif
+}
+
+
+/**
+ * @brief  end the benchmark (the simulator stops on sleep with the interrupts disabled)
+ */
+static void BENCH_exit(void)
+{
+#if ATMEGA32_HOST_BUILD
+	fflush(stdout);
+#else
+	/* wait till the last character of the results is sent */
+	while( !(_UCSRA._UDRE) );
+	while( !(_UCSRA._TXC) );
+
+	cli();
+	set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+	sleep_enable();
+	sleep_cpu();
+#endif
+}
+
+
+#if ATMEGA32_HOST_BUILD
+/**
+ * @brief  peripheral model of the PINx Registers : the pins read the value written on the PORTx Register
+ * @param  (address) data memory address of the PINx Register
+ */
+static void BENCH_modelPin(uint8 address)
+{
+	/* PORTx is 2 addresses after PINx (output pins read their value, input pins read their pull up) */
+	HOST_REG_write(address , HOST_REG_read(address + 2));
+}
+
+
+/**
+ * @brief  peripheral model of UCSRA : the transmit buffer becomes empty on the first busy poll
+ * @param  (address) data memory address of UCSRA
+ */
+static void BENCH_modelUcsra(uint8 address)
+{
+	/* create a local variable to hold the image of UCSRA */
+	UCSRA_CFG_t l_ucsra = { .Byte = HOST_REG_read(address) };
+
+	if(!l_ucsra._UDRE)
+	{
+		bench_waits++;
+		bench_wait_cycles += BENCH_HOST_UART_WAIT_CYCLES;
+		l_ucsra._UDRE = SET;
+		HOST_REG_write(address , l_ucsra.Byte);
+	}
+	else{ /* Nothing */ }
+}
+
+
+/**
+ * @brief  peripheral model of UDR : the transmit buffer becomes full when a character is written
+ * @param  (address) data memory address of UDR
+ */
+static void BENCH_modelUdr(uint8 address)
+{
+	/* create a local variable to hold the image of UCSRA */
+	UCSRA_CFG_t l_ucsra = { .Byte = HOST_REG_read(UCSRA_ADDRESS) };
+
+	l_ucsra._UDRE = RESET;
+	HOST_REG_write(UCSRA_ADDRESS , l_ucsra.Byte);
+
+	/* UDR is cleared so the next character is seen even if it's the same */
+	HOST_REG_write(address , ZERO_INIT);
+}
+
+
+/**
+ * @brief  peripheral model of SPSR : the serial transfer completes on the first busy poll
+ * @param  (address) data memory address of SPSR
+ */
+static void BENCH_modelSpsr(uint8 address)
+{
+	/* create a local variable to hold the image of SPSR */
+	SPSR_CFG_t l_spsr = { .Byte = HOST_REG_read(address) };
+
+	if(!l_spsr._SPIF)
+	{
+		bench_waits++;
+		bench_wait_cycles += BENCH_HOST_SPI_WAIT_CYCLES;
+		l_spsr._SPIF = SET;
+		HOST_REG_write(address , l_spsr.Byte);
+	}
+	else{ /* Nothing */ }
+}
+
+
+/**
+ * @brief  peripheral model of SPDR : SPIF is cleared by the SPDR access after SPSR is read
+ * @param  (address) data memory address of SPDR
+ */
+static void BENCH_modelSpdr(uint8 address)
+{
+	/* create a local variable to hold the image of SPSR */
+	SPSR_CFG_t l_spsr = { .Byte = HOST_REG_read(SPSR_ADDRESS) };
+
+	(void)address;
+
+	l_spsr._SPIF = RESET;
+	HOST_REG_write(SPSR_ADDRESS , l_spsr.Byte);
+}
+
+
+/**
+ * @brief  peripheral model of ADCSRA : the conversion completes on the first busy poll
+ * @param  (address) data memory address of ADCSRA
+ */
+static void BENCH_modelAdcsra(uint8 address)
+{
+	/* create a local variable to hold the image of ADCSRA */
+	ADCSRA_CFG_t l_adcsra = { .Byte = HOST_REG_read(address) };
+
+	if(l_adcsra._ADSC)
+	{
+		bench_waits++;
+		bench_wait_cycles += BENCH_HOST_ADC_WAIT_CYCLES;
+		l_adcsra._ADSC = RESET;
+		l_adcsra._ADIF = SET;
+		HOST_REG_write(address , l_adcsra.Byte);
+	}
+	else{ /* Nothing */ }
+}
+#else
+/**
+ * @brief  read the 32-bit cycle counter (Timer1 and its overflows)
+ * @return the number of cycles since Timer1 is started
+ */
+static uint32 BENCH_getCycles(void)
+{
+	/* create local variables to hold the low and the high 16 bits of the counter */
+	uint16 l_low = ZERO_INIT;
+	uint16 l_high = ZERO_INIT;
+	/* create a local variable to hold the Status Register */
+	uint8 l_sreg = ZERO_INIT;
+
+	CRITICAL_SECTION_ENTER(l_sreg);
+	l_low = _TCNT1.TwoBytes;
+	l_high = bench_timer_overflows;
+	/* an overflow which isn't served yet by the ISR belongs to the low 16 bits already read */
+	if( (_TIFR._TOV1) && (l_low < 0x8000) )
+	{
+		l_high++;
+	}
+	else{ /* Nothing */ }
+	CRITICAL_SECTION_EXIT(l_sreg);
+
+	return ( ((uint32)l_high << 16) | l_low );
+}
+
+
+/**
+ * @brief  measure the cycles of a function call
+ * @param  (function) the function to be measured
+ * @return the cycles of the call minus the cost of an empty call
+ */
+static uint32 BENCH_measure(void (* function)(void))
+{
+	/* create a local variable to hold the counter before the call */
+	uint32 l_start = BENCH_getCycles();
+
+	(*function)();
+
+	return ( BENCH_getCycles() - l_start - bench_overhead );
+}
+#endif
+
+
+/* --------------------------------- */
+/* benchmark cases */
+
+#if !ATMEGA32_HOST_BUILD
+/* cost of the measurement and of the call itself */
+static void BENCH_runEmpty(void)
+{
+}
+#endif
+
+static void BENCH_runGpioWritePin(void)
+{
+	GPIO_writePin(&bench_gpio_pin , GPIO_HIGH);
+}
+
+static void BENCH_runGpioReadPin(void)
+{
+	bench_sink = GPIO_readPin(&bench_gpio_pin);
+}
+
+static void BENCH_runGpioWritePinFast(void)
+{
+	GPIO_writePinFast(&bench_gpio_pin_handle , GPIO_LOW);
+}
+
+static void BENCH_runGpioReadPinFast(void)
+{
+	bench_sink = GPIO_readPinFast(&bench_gpio_pin_handle);
+}
+
+static void BENCH_runGpioWritePort(void)
+{
+	/* PORTD holds the keypad rows only, they are set to input by every keypad scan */
+	GPIO_writePort(GPIO_PORTD , 0xF0);
+}
+
+static void BENCH_runGpioWritePortMasked(void)
+{
+	GPIO_writePortMasked(GPIO_PORTA , 0x0E , 0x0A);
+}
+
+static void BENCH_runGpioReadAllPorts(void)
+{
+	bench_sink = GPIO_readAllPorts();
+}
+
+static void BENCH_runGpioSetupPinDirection(void)
+{
+	GPIO_setupPinDirection(&bench_gpio_pin);
+}
+
+static void BENCH_runGpioTogglePinFast(void)
+{
+	GPIO_togglePinFast(&bench_gpio_pin_handle);
+}
+
+static void BENCH_runGpioReadPort(void)
+{
+	bench_sink = GPIO_readPort(GPIO_PORTA);
+}
+
+static void BENCH_runGpioSetPortBits(void)
+{
+	GPIO_setPortBits(GPIO_PORTA , 0x0E);
+}
+
+static void BENCH_runGpioClearPortBits(void)
+{
+	GPIO_clearPortBits(GPIO_PORTA , 0x0E);
+}
+
+static void BENCH_runGpioBusWrite(void)
+{
+	GPIO_busWrite(&bench_gpio_bus , 0xA5);
+}
+
+static void BENCH_runGpioBusRead(void)
+{
+	bench_sink = GPIO_busRead(&bench_gpio_bus);
+}
+
+/* the transmit buffer is full when UART_sendByte is called */
+static void BENCH_setupUart(void)
+{
+#if ATMEGA32_HOST_BUILD
+	/* create a local variable to hold the image of UCSRA */
+	UCSRA_CFG_t l_ucsra = { .Byte = HOST_REG_read(UCSRA_ADDRESS) };
+
+	l_ucsra._UDRE = RESET;
+	HOST_REG_write(UCSRA_ADDRESS , l_ucsra.Byte);
+#else
+	/* the first character goes to the shift register and the second one waits in the buffer */
+	while( !(_UCSRA._UDRE) );
+	_UDR.Byte = '\n';
+	while( !(_UCSRA._UDRE) );
+	_UDR.Byte = '\n';
+#endif
+}
+
+static void BENCH_runUartSendByte(void)
+{
+	UART_sendByte('\n');
+}
+
+static void BENCH_probeUart(void)
+{
+	while( !(_UCSRA._UDRE) );
+}
+
+static void BENCH_runUartSendString(void)
+{
+	UART_sendString(bench_string);
+}
+
+/* every character waits for the transmit buffer (the writes of UDR take 1 cycle each) */
+static void BENCH_probeUartString(void)
+{
+	/* create a local variable to traverse the characters */
+	uint8 l_index = ZERO_INIT;
+
+	for(l_index = 0; bench_string[l_index] != '\0'; l_index++)
+	{
+		while( !(_UCSRA._UDRE) );
+		_UDR.Byte = bench_string[l_index];
+	}
+}
+
+/* no serial transfer is complete when SPI_sendReceiveByte is called */
+static void BENCH_setupSpi(void)
+{
+#if ATMEGA32_HOST_BUILD
+	/* create a local variable to hold the image of SPSR */
+	SPSR_CFG_t l_spsr = { .Byte = HOST_REG_read(SPSR_ADDRESS) };
+
+	l_spsr._SPIF = RESET;
+	HOST_REG_write(SPSR_ADDRESS , l_spsr.Byte);
+#endif
+}
+
+static void BENCH_runSpiSendReceiveByte(void)
+{
+	bench_sink = SPI_sendReceiveByte(0xA5);
+}
+
+static void BENCH_probeSpi(void)
+{
+	_SPDR.Byte = 0xA5;
+	while( !(_SPSR._SPIF) );
+	bench_sink = _SPDR.Byte;
+}
+
+static void BENCH_runSpiSendByte(void)
+{
+	SPI_sendByte(0xA5);
+}
+
+static void BENCH_runSpiReceiveByte(void)
+{
+	bench_sink = SPI_receiveByte();
+}
+
+static void BENCH_runSpiSendString(void)
+{
+	SPI_sendString(bench_string);
+}
+
+/* every character is a serial transfer */
+static void BENCH_probeSpiString(void)
+{
+	/* create a local variable to traverse the characters */
+	uint8 l_index = ZERO_INIT;
+
+	for(l_index = 0; bench_string[l_index] != '\0'; l_index++)
+	{
+		_SPDR.Byte = bench_string[l_index];
+		while( !(_SPSR._SPIF) );
+		bench_sink = _SPDR.Byte;
+	}
+}
+
+static void BENCH_runAdcReadChannelBlocking(void)
+{
+	bench_sink = ADC_readChannelBlocking(ADC_CHANNEL0);
+}
+
+static void BENCH_probeAdc(void)
+{
+	ADC_START_CONVERSION();
+	while( !(_ADCSRA._ADIF) );
+	ADC_CLEAR_INTERRUPT_FLAG();
+}
+
+/* the conversion is started only */
+static void BENCH_runAdcReadChannelNonBlocking(void)
+{
+	ADC_readChannelNonBlocking(ADC_CHANNEL0);
+}
+
+static void BENCH_runLcdSendCommand(void)
+{
+	LCD_sendCommand(&bench_lcd , LCD_DDRAM_SET_ADDRESS);
+}
+
+static void BENCH_runLcdDisplayCharacter(void)
+{
+	LCD_displayCharacter(&bench_lcd , 'A');
+}
+
+static void BENCH_runLcdDisplayString(void)
+{
+	LCD_displayString(&bench_lcd , "OK");
+}
+
+static void BENCH_runLcdMoveCursor(void)
+{
+	LCD_moveCursor(&bench_lcd , 1 , 5);
+}
+
+static void BENCH_runLcdIntegerToString(void)
+{
+	LCD_intgerToString(&bench_lcd , 1234);
+}
+
+static void BENCH_runLcdClearScreen(void)
+{
+	LCD_clearScreen(&bench_lcd);
+}
+
+/* no button is pressed, the whole keypad is scanned */
+static void BENCH_runKeypadGetPressedKey(void)
+{
+	bench_sink = KEYPAD_getPressedKey(&bench_keypad);
+}
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------------ISR section---------------------- */
+
+
+#if !ATMEGA32_HOST_BUILD
+/**
+ * @brief  Timer1 Overflow ISR (high 16 bits of the cycle counter)
+ */
+ISR(TIMER1_OVF_vect)
+{
+	bench_timer_overflows++;
+}
+#endif
+
+
+/* ----------------------------------------------------------------------------------- */
@@ -0,0 +1,142 @@
+#!/bin/bash
+#
+# =========================================================================================
+# Name        : bench.sh
+# Author      : Mohamed Ashraf El-Sayed
+# Version     : 1.0.0
+# Copyright   : Your copyright notice
+# date        : Fri, Oct 16 2026
+# time        :
+# Description : Driver APIs Cycle-Cost Micro-Benchmark Runner
+# =========================================================================================
+#
+# builds TOOLS/bench/bench.c with the drivers under benchmark, runs it and compares its result lines with a baseline :
+#
+#	--host	(default) host build on the register file of COMMON/HOST, reports the Register accesses/reads/writes,
+#			the blocking waits, the delays and the estimated (not measured) CPU cycles of every API split into blocking-wait
+#			cycles and CPU work (no AVR toolchain is needed, see TOOLS/bench/bench.c) >> baseline : TOOLS/bench/baseline_host.txt
+#	--avr	avr-gcc build run on the simulator (or on a board by AVR_RUN), reports the measured CPU cycles of every API
+#			split into blocking-wait cycles and CPU work >> baseline : TOOLS/bench/baseline_avr.txt
+#			(not committed : the first run on a machine with the AVR toolchain is done with --update)
+#
+#	BENCH UART_sendByte cycles=8391 wait=8330 cpu=61
+#	BENCH UART_sendByte accesses=3 reads=2 writes=1 waits=1 delay_us=0 est_cycles=8345 est_wait=8333 est_cpu=12
+#
+# usage (from any directory) :
+#	TOOLS/bench/bench.sh [--host|--avr] [--update]
+#
+#	--update	write the results as the new baseline instead of comparing
+#
+# environment :
+#	CC			host compiler (default : gcc)
+#	CROSS		toolchain prefix of the AVR build (default : avr-)
+#	MCU			the -mmcu of the AVR build (default : atmega32)
+#	F_CPU		MCU Frequency of the AVR build in Hz (default : 8000000)
+#	AVR_RUN		command which runs the AVR build and prints its UART output, the .elf file is appended
+#				(default : simavr -m atmega32 -f F_CPU)
+#	CFLAGS		extra compiler flags
+#
+# exit status : 0 >> no metric is higher than the baseline, 1 >> regression (or no baseline), 2 >> build/run error
+#
+
+MODE="host"
+UPDATE=0
+for ARG in "$@"; do
+	case "$ARG" in
+		--host)		MODE="host" ;;
+		--avr)		MODE="avr" ;;
+		--update)	UPDATE=1 ;;
+		*)			echo "usage: $0 [--host|--avr] [--update]" >&2; exit 2 ;;
+	esac
+done
+
+CC="${CC:-gcc}"
+CROSS="${CROSS-avr-}"
+MCU="${MCU:-atmega32}"
+F_CPU="${F_CPU:-8000000}"
+AVR_RUN="${AVR_RUN:-simavr -m $MCU -f $F_CPU}"
+
+ROOT="$(cd "$(dirname "$0")/../.." && pwd)"
+BENCH="$ROOT/TOOLS/bench"
+BASELINE="$BENCH/baseline_$MODE.txt"
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+# drivers under benchmark
+SOURCES=(
+"$BENCH/bench.c"
+"$ROOT/MCAL/GPIO/gpio.c"
+"$ROOT/MCAL/UART/usart.c"
+"$ROOT/MCAL/SPI/spi.c"
+"$ROOT/MCAL/ADC/adc.c"
+"$ROOT/HAL/LCD/lcd.c"
+"$ROOT/HAL/KEYPAD/keypad.c"
+)
+
+# include directories of the drivers
+INCLUDES=()
+while IFS= read -r DIR; do
+	INCLUDES+=("-I$DIR")
+done < <(find "$ROOT/MCAL" "$ROOT/HAL" "$ROOT/SERVICE" -type d)
+
+# --------------------------------- #
+# build and run
+
+if [ "$MODE" = "host" ]; then
+	$CC -std=gnu99 -O1 -DATMEGA32_HOST_BUILD=1 -DCPU_TYPE=CPU_TYPE_64 -fno-strict-aliasing $CFLAGS \
+		"-I$ROOT/COMMON/HOST" "-I$ROOT/COMMON" "${INCLUDES[@]}" \
+		"${SOURCES[@]}" "$ROOT/COMMON/HOST/host_registers.c" "$ROOT/COMMON/HOST/host_trace.c" \
+		-o "$WORK/bench" || exit 2
+	"$WORK/bench" > "$WORK/output.txt" 2> "$WORK/registers.txt" || exit 2
+else
+	# TOOLS/bench comes first so the drivers include its util/delay.h which counts the delay cycles
+	${CROSS}gcc -std=gnu99 -Os -mmcu="$MCU" -DF_CPU="${F_CPU}UL" -DCPU_FREQUENCY="${F_CPU}UL" $CFLAGS \
+		"-I$BENCH" "-I$ROOT/COMMON" "${INCLUDES[@]}" \
+		"${SOURCES[@]}" -o "$WORK/bench.elf" || exit 2
+	$AVR_RUN "$WORK/bench.elf" > "$WORK/output.txt" 2>&1
+fi
+
+# keep the result lines only (the simulator may prefix the UART output)
+sed -n 's/^.*\(BENCH \)/\1/p' "$WORK/output.txt" | tr -d '\r' > "$WORK/results.txt"
+
+if ! grep -q "^BENCH END$" "$WORK/results.txt"; then
+	echo "bench: the benchmark didn't complete :" >&2
+	cat "$WORK/output.txt" >&2
+	exit 2
+fi
+sed -i '/^BENCH END$/d' "$WORK/results.txt"
+
+cat "$WORK/results.txt"
+
+# --------------------------------- #
+# baseline
+
+if [ "$UPDATE" = "1" ]; then
+	cp "$WORK/results.txt" "$BASELINE"
+	echo "bench: baseline updated : $BASELINE"
+	exit 0
+fi
+
+if [ ! -f "$BASELINE" ]; then
+	echo "bench: no baseline ($BASELINE), run with --update to create it" >&2
+	exit 1
+fi
+
+# every metric of every case is compared with the baseline, a higher value is a regression
+awk '
+	FNR == NR { for (i = 3; i <= NF; i++) { split($i, kv, "="); base[$2 "," kv[1]] = kv[2] } next }
+	{
+		for (i = 3; i <= NF; i++) {
+			split($i, kv, "=")
+			key = $2 "," kv[1]
+			if (!(key in base)) { printf "bench: new       %-26s %-10s %s\n", $2, kv[1], kv[2]; continue }
+			if (kv[2] + 0 > base[key] + 0) { printf "bench: REGRESSED %-26s %-10s %s -> %s\n", $2, kv[1], base[key], kv[2]; failed = 1 }
+			else if (kv[2] + 0 < base[key] + 0) { printf "bench: improved  %-26s %-10s %s -> %s\n", $2, kv[1], base[key], kv[2] }
+		}
+	}
+	END { exit failed }
+' "$BASELINE" "$WORK/results.txt"
+STATUS=$?
+
+[ "$STATUS" = "0" ] && echo "bench: no regression against $BASELINE"
+exit $STATUS
@@ -0,0 +1,47 @@
+/*
+ =========================================================================================
+ Name        : delay.h
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : Benchmark wrapper of avr-libc util/delay.h , Ansi-style
+ =========================================================================================
+*/
+
+#ifndef _BENCH_UTIL_DELAY_H_
+#define _BENCH_UTIL_DELAY_H_
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include "std_types.h"
+#include "timing.h"
+
+/*
+ * the drivers include "util/delay.h", the benchmark build puts -ITOOLS/bench first so this file is included instead :
+ * 	- the avr-libc delays are renamed and included, then every delay of a driver adds its cycles to bench_delay_cycles
+ * 	  before it waits, so the benchmark reports the delays as blocking-wait cycles and not as CPU work
+ */
+#define _delay_ms						_delay_ms_libc
+#define _delay_us						_delay_us_libc
+#include_next <util/delay.h>
+#undef _delay_ms
+#undef _delay_us
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -------------------Global section-------------------- */
+
+/* cycles of the delays since the benchmark cleared it (defined in bench.c) */
+extern volatile uint32 bench_delay_cycles;
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+#define _delay_ms(MS)					do{ bench_delay_cycles += (uint32)( (MS) * (CPU_FREQUENCY / 1000UL) ); _delay_ms_libc(MS); }while(0)
+#define _delay_us(US)					do{ bench_delay_cycles += (uint32)( (US) * (CPU_FREQUENCY / 1000000UL) ); _delay_us_libc(US); }while(0)
+
+
+/* ----------------------------------------------------------------------------------- */
+#endif /* _BENCH_UTIL_DELAY_H_ */
@@ -0,0 +1,170 @@
+#!/bin/bash
+#
+# =========================================================================================
+# Name        : footprint.sh
+# Author      : Mohamed Ashraf El-Sayed
+# Version     : 1.0.0
+# Copyright   : Your copyright notice
+# date        : Fri, Oct 16 2026
+# time        :
+# Description : Per Driver Flash/SRAM Footprint Report
+# =========================================================================================
+#
+# compiles every MCAL/HAL/SERVICE module under each of its compile-time modes (the VARIANTS table below)
+# and reports the .text, .data and .bss sizes per module and per function as a CSV table :
+#
+#	record,module,variant,symbol,text,data,bss
+#	module,MCAL/TIMER1/timer1.c,CTC,,1234,0,6
+#	function,MCAL/TIMER1/timer1.c,CTC,TIMER1_CTC_init,310,0,0
+#
+# usage (from the repository root) :
+#	TOOLS/footprint/footprint.sh [output.csv]			(default : footprint.csv)
+#
+# environment :
+#	CROSS		toolchain prefix (default : avr-)
+#	MCU			the -mmcu of the build (default : atmega32)
+#	CFLAGS		extra compiler flags
+#
+# flash = text + data (the initial values of .data are stored in flash), SRAM = data + bss
+# every module is compiled alone so the sizes don't include the drivers it calls
+#
+
+CROSS="${CROSS-avr-}"
+MCU="${MCU:-atmega32}"
+OUTPUT="${1:-footprint.csv}"
+
+ROOT="$(cd "$(dirname "$0")/../.." && pwd)"
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+# --------------------------------- #
+# VARIANTS : module|variant name|header:MACRO=VALUE,header:MACRO=VALUE (empty >> the configuration of the repository)
+# every module which isn't listed is compiled once with the configuration of the repository (variant "default")
+
+VARIANTS=(
+"MCAL/TIMER0/timer0.c|OVER_FLOW|MCAL/TIMER0/timer0.h:TIMER0_MODE_SELECT=TIMER0_MODE_OVER_FLOW"
+"MCAL/TIMER0/timer0.c|CTC|MCAL/TIMER0/timer0.h:TIMER0_MODE_SELECT=TIMER0_MODE_CLEAR_TIMER_ON_COMPARE_MATCH"
+"MCAL/TIMER0/timer0.c|PWM|MCAL/TIMER0/timer0.h:TIMER0_MODE_SELECT=TIMER0_MODE_PWM"
+"MCAL/TIMER1/timer1.c|OVER_FLOW|MCAL/TIMER1/timer1.h:TIMER1_MODE_SELECT=TIMER1_MODE_OVER_FLOW"
+"MCAL/TIMER1/timer1.c|CTC|MCAL/TIMER1/timer1.h:TIMER1_MODE_SELECT=TIMER1_MODE_CLEAR_TIMER_ON_COMPARE_MATCH"
+"MCAL/TIMER1/timer1.c|PWM|MCAL/TIMER1/timer1.h:TIMER1_MODE_SELECT=TIMER1_MODE_PWM"
+"MCAL/UART/usart.c|RX_INTERRUPT|"
+"MCAL/UART/usart.c|ALL_INTERRUPTS|MCAL/UART/usart.h:USART_CFG_TX_COMPLETE_INTERRUPT=USART_CFG_ENABLE,MCAL/UART/usart.h:USART_CFG_TX_BUFFER_EMPTY_INTERRUPT=USART_CFG_ENABLE"
+"MCAL/UART/usart.c|NO_INTERRUPTS|MCAL/UART/usart.h:USART_CFG_RX_COMPLETE_INTERRUPT=USART_CFG_DISABLE"
+"MCAL/UART/usart.c|TX_RING|MCAL/UART/usart.h:USART_CFG_TX_BUFFER_EMPTY_INTERRUPT=USART_CFG_ENABLE,MCAL/UART/usart.h:USART_CFG_TX_RING_BUFFER=USART_CFG_ENABLE"
+"MCAL/UART/usart.c|TX_DESCRIPTOR_QUEUE|MCAL/UART/usart.h:USART_CFG_TX_BUFFER_EMPTY_INTERRUPT=USART_CFG_ENABLE,MCAL/UART/usart.h:USART_CFG_TX_DESCRIPTOR_QUEUE=USART_CFG_ENABLE"
+"MCAL/UART/usart.c|RX_RING|MCAL/UART/usart.h:USART_CFG_RX_RING_BUFFER=USART_CFG_ENABLE"
+"MCAL/UART/usart.c|STATIC_BAUD_RATE|MCAL/UART/usart.h:USART_CFG_STATIC_BAUD_RATE=USART_CFG_ENABLE"
+"MCAL/EXTI/exti.c|INT0_INT1_INT2|"
+"MCAL/EXTI/exti.c|INT0|MCAL/EXTI/exti.h:EXTI_CFG_INT1_INTERRUPT=EXTI_CFG_DISABLE,MCAL/EXTI/exti.h:EXTI_CFG_INT2_INTERRUPT=EXTI_CFG_DISABLE"
+"HAL/LCD/lcd.c|8_BIT|HAL/LCD/lcd.h:LCD_CONFIG_4_BIT_MODE=DISABLE,HAL/LCD/lcd.h:LCD_CONFIG_8_BIT_MODE=ENABLE"
+"HAL/LCD/lcd.c|4_BIT|HAL/LCD/lcd.h:LCD_CONFIG_4_BIT_MODE=ENABLE,HAL/LCD/lcd.h:LCD_CONFIG_8_BIT_MODE=DISABLE"
+"HAL/LCD/lcd.c|4_BIT_DATA_BUS_GROUP|HAL/LCD/lcd.h:LCD_CONFIG_4_BIT_MODE=ENABLE,HAL/LCD/lcd.h:LCD_CONFIG_8_BIT_MODE=DISABLE,HAL/LCD/lcd.h:LCD_CONFIG_DATA_BUS_GROUP=ENABLE"
+"HAL/LCD/lcd.c|8_BIT_DATA_BUS_GROUP|HAL/LCD/lcd.h:LCD_CONFIG_4_BIT_MODE=DISABLE,HAL/LCD/lcd.h:LCD_CONFIG_8_BIT_MODE=ENABLE,HAL/LCD/lcd.h:LCD_CONFIG_DATA_BUS_GROUP=ENABLE"
+"HAL/LCD/lcd.c|4_BIT_STATIC_PINS|HAL/LCD/lcd.h:LCD_CONFIG_4_BIT_MODE=ENABLE,HAL/LCD/lcd.h:LCD_CONFIG_8_BIT_MODE=DISABLE,HAL/LCD/lcd.h:LCD_CONFIG_STATIC_PINS=ENABLE"
+"HAL/KEYPAD/keypad.c|4X4|HAL/KEYPAD/keypad.h:KEYPAD_CONFIG_4X3_MODE=DISABLE,HAL/KEYPAD/keypad.h:KEYPAD_CONFIG_4X4_MODE=ENABLE"
+"HAL/KEYPAD/keypad.c|4X3|HAL/KEYPAD/keypad.h:KEYPAD_CONFIG_4X3_MODE=ENABLE,HAL/KEYPAD/keypad.h:KEYPAD_CONFIG_4X4_MODE=DISABLE"
+"HAL/KEYPAD/keypad.c|4X4_STATIC_PINS|HAL/KEYPAD/keypad.h:KEYPAD_CONFIG_STATIC_PINS=ENABLE"
+"HAL/KEYPAD/keypad.c|4X4_PIN_GROUPS|HAL/KEYPAD/keypad.h:KEYPAD_CONFIG_PIN_GROUPS=ENABLE"
+"HAL/DC MOTOR/dc_motor.c|WITHOUT_PWM|HAL/DC MOTOR/dc_motor.h:DC_MOTOR_MODE_SELECT=DC_MOTOR_MODE_WITHOUT_PWM"
+"HAL/DC MOTOR/dc_motor.c|WITH_TIMER0_PWM|HAL/DC MOTOR/dc_motor.h:DC_MOTOR_MODE_SELECT=DC_MOTOR_MODE_WITH_TIMER0_PWM"
+"HAL/DC MOTOR/dc_motor.c|WITH_TIMER1_PWM|HAL/DC MOTOR/dc_motor.h:DC_MOTOR_MODE_SELECT=DC_MOTOR_MODE_WITH_TIMER1_PWM,MCAL/TIMER1/timer1.h:TIMER1_MODE_SELECT=TIMER1_MODE_PWM"
+"HAL/ULTRASONIC/Ultrasonic.c|ICU|MCAL/TIMER1/timer1.h:TIMER1_MODE_SELECT=TIMER1_MODE_OVER_FLOW"
+"HAL/ULTRASONIC/Ultrasonic.c|ICU_STATIC_TRIGGER_PIN|MCAL/TIMER1/timer1.h:TIMER1_MODE_SELECT=TIMER1_MODE_OVER_FLOW,HAL/ULTRASONIC/Ultrasonic.h:ULTRASONIC_CONFIG_STATIC_TRIGGER_PIN=ENABLE"
+"SERVICE/AUTOBAUD/autobaud.c|ICU|MCAL/TIMER1/timer1.h:TIMER1_MODE_SELECT=TIMER1_MODE_OVER_FLOW"
+)
+
+# --------------------------------- #
+# check the toolchain
+
+for tool in gcc size nm; do
+	if ! command -v "${CROSS}${tool}" > /dev/null 2>&1; then
+		echo "footprint: ${CROSS}${tool} is not found (set CROSS to the toolchain prefix)" >&2
+		exit 1
+	fi
+done
+
+# --------------------------------- #
+# compile a module in a copy of the repository with the variant configuration and append its rows to the report
+# $1 : module, $2 : variant name, $3 : configuration
+
+footprint_module()
+{
+	local module="$1" variant="$2" config="$3"
+	local tree="$WORK/tree" object="$WORK/module.o"
+	local setting header macro value
+	local -a includes
+
+	rm -rf "$tree" && mkdir -p "$tree"
+	cp -r "$ROOT/COMMON" "$ROOT/MCAL" "$ROOT/HAL" "$tree/"
+	[ -d "$ROOT/SERVICE" ] && cp -r "$ROOT/SERVICE" "$tree/"
+	rm -rf "$tree/COMMON/HOST"
+
+	# apply the configuration : replace the value of every configured macro
+	IFS=',' read -r -a settings <<< "$config"
+	for setting in "${settings[@]}"; do
+		[ -z "$setting" ] && continue
+		header="${setting%%:*}"
+		macro="${setting#*:}"; macro="${macro%%=*}"
+		value="${setting#*=}"
+		if ! grep -q "^#define[[:space:]]\+${macro}[[:space:]]" "$tree/$header"; then
+			echo "footprint: ${macro} is not defined in ${header}" >&2
+			return 1
+		fi
+		sed -i "s|^#define[[:space:]]\+${macro}[[:space:]].*|#define ${macro} ${value}|" "$tree/$header"
+	done
+
+	while IFS= read -r dir; do includes+=("-I$dir"); done < <(find "$tree/COMMON" "$tree/MCAL" "$tree/HAL" "$tree/SERVICE" -type d 2>/dev/null)
+
+	if ! "${CROSS}gcc" -mmcu="$MCU" -std=gnu99 -Os -ffunction-sections -fdata-sections -Wall $CFLAGS \
+			"${includes[@]}" -c "$tree/$module" -o "$object" 2> "$WORK/errors.txt"; then
+		echo "footprint: ${module} (${variant}) doesn't compile :" >&2
+		head -5 "$WORK/errors.txt" >&2
+		return 1
+	fi
+
+	# the warnings of the variant are reported but don't fail the report
+	if [ -s "$WORK/errors.txt" ]; then
+		echo "footprint: ${module} (${variant}) warnings :" >&2
+		cat "$WORK/errors.txt" >&2
+	fi
+
+	# module sizes (Berkeley format : text data bss dec hex filename)
+	"${CROSS}size" -B "$object" | awk -v m="$module" -v v="$variant" 'NR == 2 { printf "module,\"%s\",%s,,%d,%d,%d\n", m, v, $1, $2, $3 }' >> "$OUTPUT"
+
+	# function and variable sizes (symbol table : value size type name)
+	"${CROSS}nm" -S --size-sort --radix=d "$object" | awk -v m="$module" -v v="$variant" '
+		NF == 4 {
+			text = 0; data = 0; bss = 0; size = $2 + 0
+			if($3 ~ /^[TtWw]$/)			{ text = size }
+			else if($3 ~ /^[DdRrGg]$/)	{ data = size }
+			else if($3 ~ /^[BbSsCcVv]$/){ bss = size }
+			else						{ next }
+			printf "function,\"%s\",%s,%s,%d,%d,%d\n", m, v, $4, text, data, bss
+		}' >> "$OUTPUT"
+}
+
+# --------------------------------- #
+# report
+
+echo "record,module,variant,symbol,text,data,bss" > "$OUTPUT"
+
+status=0
+while IFS= read -r module; do
+	found=0
+	for entry in "${VARIANTS[@]}"; do
+		IFS='|' read -r v_module v_name v_config <<< "$entry"
+		if [ "$v_module" = "$module" ]; then
+			found=1
+			footprint_module "$module" "$v_name" "$v_config" || status=1
+		fi
+	done
+	if [ "$found" = 0 ]; then
+		footprint_module "$module" "default" "" || status=1
+	fi
+done < <(cd "$ROOT" && find MCAL HAL SERVICE -name '*.c' | sort)
+
+# summary : flash and SRAM per module variant
+awk -F',' 'NR > 1 && $1 == "module" { printf "%-40s %-26s flash=%6d sram=%5d\n", $2, $3, $5 + $6, $6 + $7 }' "$OUTPUT" | tr -d '"'
+
+exit $status
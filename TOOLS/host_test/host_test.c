@@ -0,0 +1,264 @@
+/*
+ =========================================================================================
+ Name        : host_test.c
+ Author      : Mohamed Ashraf El-Sayed
+ Version     : 1.0.0
+ Copyright   : Your copyright notice
+ date        : Fri, Oct 16 2026
+ time        :
+ Description : Host Build Driver Tests Source file , Ansi-style
+ =========================================================================================
+*/
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------------Includes section------------------- */
+#include <stdio.h>
+
+#include "gpio.h"
+#include "usart.h"
+#include "host_registers.h"
+#include "host_trace.h"
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------------Macro declaration section-------------- */
+
+/*
+ * Host Build Driver Tests (driven by TOOLS/host_test/host_test.sh) :
+ * 	- the drivers run unchanged on the register file of COMMON/HOST, the peripherals are modeled by the Register hooks
+ * 	- every failed check prints "FAIL <test>: <check>" , the last line is "host_test: <checks> checks , <failed> failed"
+ * 	- exit status : 0 >> all the checks passed , 1 >> a check failed
+ */
+
+/* UART BAUD RATE of the test and its UBRR value at 8 MHz (Normal Speed) */
+#define HOST_TEST_BAUD_RATE						9600
+#define HOST_TEST_UBRR							51
+
+
+/* ----------------------------------------------------------------------------------- */
+/* --------Macro functions declaration section---------- */
+
+/* count a check and print it if it fails */
+#define HOST_TEST_CHECK(CONDITION)				HOST_TEST_check( (CONDITION) , __func__ , #CONDITION )
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions declaration section------------ */
+
+
+/**
+ * @brief  count a check and print it if it fails
+ * @param  (condition) result of the check (TRUE >> passed)
+ * @param  (test)      name of the test
+ * @param  (text)      the checked condition
+ */
+static void HOST_TEST_check(uint8 condition , const char *test , const char *text);
+
+
+/**
+ * @brief  peripheral model of the PINx Registers : the pins read the value written on the PORTx Register
+ * @param  (address) data memory address of the PINx Register
+ */
+static void HOST_TEST_modelPin(uint8 address);
+
+
+/**
+ * @brief  peripheral model of UDR in Loop Back : the transmitted character is received (RXC is set)
+ * @param  (address) data memory address of UDR
+ */
+static void HOST_TEST_modelUdr(uint8 address);
+
+
+/**
+ * @brief  write hook which counts the writes of a Register
+ * @param  (address) data memory address of the Register
+ */
+static void HOST_TEST_countWrite(uint8 address);
+
+
+/* --------------------------------- */
+/* tests */
+
+static void HOST_TEST_gpioRoundTrip(void);
+static void HOST_TEST_uartRoundTrip(void);
+static void HOST_TEST_writeCredit(void);
+
+
+/* ----------------------------------------------------------------------------------- */
+/* -------------------Global section-------------------- */
+
+/* checks done and failed */
+static uint32 host_test_checks = ZERO_INIT;
+static uint32 host_test_failed = ZERO_INIT;
+
+/* characters transmitted by the UART */
+static uint8 host_test_tx_count = ZERO_INIT;
+
+/* writes counted by HOST_TEST_countWrite */
+static uint8 host_test_writes[HOST_REGISTERS_SIZE];
+
+
+/* ----------------------------------------------------------------------------------- */
+/* ------------functions definition section------------- */
+
+
+int main(void)
+{
+	/* the Register summaries of the traced calls aren't printed */
+	HOST_TRACE_setOutput(fopen("/dev/null" , "w"));
+
+	HOST_TEST_gpioRoundTrip();
+	HOST_TEST_uartRoundTrip();
+	HOST_TEST_writeCredit();
+
+	printf("host_test: %lu checks , %lu failed\n" , (unsigned long)host_test_checks , (unsigned long)host_test_failed);
+
+	return (ZERO_INIT == host_test_failed) ? 0 : 1;
+}
+
+
+/**
+ * @brief  count a check and print it if it fails
+ * @param  (condition) result of the check (TRUE >> passed)
+ * @param  (test)      name of the test
+ * @param  (text)      the checked condition
+ */
+static void HOST_TEST_check(uint8 condition , const char *test , const char *text)
+{
+	host_test_checks++;
+
+	if(!condition)
+	{
+		host_test_failed++;
+		printf("FAIL %s: %s\n" , test , text);
+	}
+	else{ /* Nothing */ }
+}
+
+
+/**
+ * @brief  peripheral model of the PINx Registers : the pins read the value written on the PORTx Register
+ * @param  (address) data memory address of the PINx Register
+ */
+static void HOST_TEST_modelPin(uint8 address)
+{
+	/* PORTx is 2 addresses after PINx */
+	HOST_REG_write(address , HOST_REG_read(address + 2));
+}
+
+
+/**
+ * @brief  peripheral model of UDR in Loop Back : the transmitted character is received (RXC is set)
+ * @param  (address) data memory address of UDR
+ */
+static void HOST_TEST_modelUdr(uint8 address)
+{
+	/* create a local variable to hold the image of UCSRA */
+	UCSRA_CFG_t l_ucsra = { .Byte = HOST_REG_read(UCSRA_ADDRESS) };
+
+	(void)address;
+
+	host_test_tx_count++;
+	l_ucsra._RXC = SET;
+	HOST_REG_write(UCSRA_ADDRESS , l_ucsra.Byte);
+}
+
+
+/**
+ * @brief  write hook which counts the writes of a Register
+ * @param  (address) data memory address of the Register
+ */
+static void HOST_TEST_countWrite(uint8 address)
+{
+	host_test_writes[address]++;
+}
+
+
+/* --------------------------------- */
+/* tests */
+
+/* a pin written high/low is read back through its PINx Register */
+static void HOST_TEST_gpioRoundTrip(void)
+{
+	/* create a local variable to hold the tested pin */
+	gpio_config_t l_pin = { GPIO_PORTA , GPIO_PIN3 , GPIO_MODE_OUTPUT };
+
+	HOST_REG_reset();
+	HOST_REG_setAccessHook(PINA_ADDRESS , HOST_TEST_modelPin);
+
+	HOST_TEST_CHECK(E_OK == GPIO_setupPinDirection(&l_pin));
+	HOST_REG_sync();
+	HOST_TEST_CHECK(0x08 == HOST_REG_read(DDRA_ADDRESS));
+
+	HOST_TEST_CHECK(E_OK == GPIO_writePin(&l_pin , GPIO_HIGH));
+	HOST_TEST_CHECK(GPIO_HIGH == GPIO_readPin(&l_pin));
+	HOST_TEST_CHECK(0x08 == HOST_REG_read(PORTA_ADDRESS));
+
+	HOST_TEST_CHECK(E_OK == GPIO_writePin(&l_pin , GPIO_LOW));
+	HOST_TEST_CHECK(GPIO_LOW == GPIO_readPin(&l_pin));
+	HOST_TEST_CHECK(0x00 == HOST_REG_read(PORTA_ADDRESS));
+}
+
+/* a character sent in Loop Back is received */
+static void HOST_TEST_uartRoundTrip(void)
+{
+	/* create a local variable to hold the configurations of the UART */
+	uart_config_t l_uart = { .Baud_Rate = HOST_TEST_BAUD_RATE , .receiver_enable = SET , .transmitter_enable = SET ,
+							 .char_size = UART_CHARACTER_SIZE_8_BITS , .parity_mode = UART_PARITY_MODE_DISABLE ,
+							 .stop_mode = UART_STOP_MODE_1_BIT };
+	/* create a local variable to hold the image of UCSRA */
+	UCSRA_CFG_t l_ucsra = { .Byte = ZERO_INIT };
+
+	HOST_REG_reset();
+	HOST_REG_setWriteHook(UDR_ADDRESS , HOST_TEST_modelUdr);
+	host_test_tx_count = ZERO_INIT;
+
+	HOST_TEST_CHECK(E_OK == UART_init(&l_uart));
+	HOST_REG_sync();
+	HOST_TEST_CHECK(HOST_TEST_UBRR == HOST_REG_read(UBRRL_ADDRESS));
+
+	/* the transmit buffer is empty */
+	l_ucsra._UDRE = SET;
+	HOST_REG_write(UCSRA_ADDRESS , l_ucsra.Byte);
+
+	UART_sendByte('A');
+	HOST_TEST_CHECK('A' == UART_recieveByte());
+
+	UART_sendByte('Z');
+	HOST_TEST_CHECK('Z' == UART_recieveByte());
+
+	HOST_REG_sync();
+	HOST_TEST_CHECK(2 == host_test_tx_count);
+}
+
+/* a write is credited to the changed Register even if another Register is accessed after it in the same expression */
+static void HOST_TEST_writeCredit(void)
+{
+	HOST_REG_reset();
+	HOST_REG_write(ICR1L_ADDRESS , 0xE8);
+	HOST_REG_write(ICR1L_ADDRESS + 1 , 0x03);
+	HOST_REG_setWriteHook(OCR1AL_ADDRESS , HOST_TEST_countWrite);
+	HOST_REG_setWriteHook(OCR1AL_ADDRESS + 1 , HOST_TEST_countWrite);
+	HOST_REG_setWriteHook(ICR1L_ADDRESS , HOST_TEST_countWrite);
+	HOST_REG_setWriteHook(ICR1L_ADDRESS + 1 , HOST_TEST_countWrite);
+	host_test_writes[OCR1AL_ADDRESS] = ZERO_INIT;
+	host_test_writes[OCR1AL_ADDRESS + 1] = ZERO_INIT;
+	host_test_writes[ICR1L_ADDRESS] = ZERO_INIT;
+	host_test_writes[ICR1L_ADDRESS + 1] = ZERO_INIT;
+
+	/* OCR1A is accessed before ICR1 and stored after it (as in TIMER1_PWM_Start) */
+	HOST_TRACE_begin("writeCredit");
+	_OCR1A.TwoBytes = (uint16)( (25UL * _ICR1.TwoBytes) / 100 );
+	HOST_TRACE_end();
+
+	HOST_TEST_CHECK(250 == ( HOST_REG_read(OCR1AL_ADDRESS) | (HOST_REG_read(OCR1AL_ADDRESS + 1) << 8) ));
+	HOST_TEST_CHECK(1 == host_test_writes[OCR1AL_ADDRESS]);
+	HOST_TEST_CHECK(0 == host_test_writes[ICR1L_ADDRESS]);
+	HOST_TEST_CHECK(0 == host_test_writes[ICR1L_ADDRESS + 1]);
+	HOST_TEST_CHECK(2 == HOST_TRACE_getAccesses());
+	HOST_TEST_CHECK(1 == HOST_TRACE_getWrites());
+	HOST_TEST_CHECK(1 == HOST_TRACE_getReads());
+}
+
+
+/* ----------------------------------------------------------------------------------- */
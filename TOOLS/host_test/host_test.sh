@@ -0,0 +1,49 @@
+#!/bin/bash
+#
+# =========================================================================================
+# Name        : host_test.sh
+# Author      : Mohamed Ashraf El-Sayed
+# Version     : 1.0.0
+# Copyright   : Your copyright notice
+# date        : Fri, Oct 16 2026
+# time        :
+# Description : Host Build Driver Tests Runner
+# =========================================================================================
+#
+# builds TOOLS/host_test/host_test.c with the drivers under test on the register file of COMMON/HOST and runs it
+#
+# usage (from any directory) :
+#	TOOLS/host_test/host_test.sh
+#
+# environment :
+#	CC			host compiler (default : gcc)
+#	CFLAGS		extra compiler flags (e.g. -fsanitize=address,undefined)
+#
+# exit status : 0 >> all the checks passed, 1 >> a check failed, 2 >> build error
+#
+
+CC="${CC:-gcc}"
+
+ROOT="$(cd "$(dirname "$0")/../.." && pwd)"
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+# drivers under test
+SOURCES=(
+"$ROOT/TOOLS/host_test/host_test.c"
+"$ROOT/MCAL/GPIO/gpio.c"
+"$ROOT/MCAL/UART/usart.c"
+)
+
+# include directories of the drivers
+INCLUDES=()
+while IFS= read -r DIR; do
+	INCLUDES+=("-I$DIR")
+done < <(find "$ROOT/MCAL" "$ROOT/HAL" "$ROOT/SERVICE" -type d)
+
+$CC -std=gnu99 -O1 -DATMEGA32_HOST_BUILD=1 -DCPU_TYPE=CPU_TYPE_64 -fno-strict-aliasing $CFLAGS \
+	"-I$ROOT/COMMON/HOST" "-I$ROOT/COMMON" "${INCLUDES[@]}" \
+	"${SOURCES[@]}" "$ROOT/COMMON/HOST/host_registers.c" "$ROOT/COMMON/HOST/host_trace.c" \
+	-o "$WORK/host_test" || exit 2
+
+"$WORK/host_test"